@@ -0,0 +1,140 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/bqueue.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define BATCH (1 << 5)
+
+typedef struct condvar_queue {
+    squeue_s queue;
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    bool closed;
+} condvar_queue_s;
+
+static size_t count = 1 << 21;
+static condvar_queue_s condvar;
+static bqueue_s queue;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * condvar_produce(void * args) {
+    (void)(args);
+    for (DATA_TYPE i = 0; i < count; ++i) {
+        pthread_mutex_lock(&condvar.mutex);
+        sque_enqueue(&condvar.queue, &i, sizeof(DATA_TYPE));
+        pthread_cond_signal(&condvar.not_empty); // signals on every element like a plain condvar wrapper
+        pthread_mutex_unlock(&condvar.mutex);
+    }
+
+    pthread_mutex_lock(&condvar.mutex);
+    condvar.closed = true;
+    pthread_cond_broadcast(&condvar.not_empty);
+    pthread_mutex_unlock(&condvar.mutex);
+    return NULL;
+}
+
+static void * condvar_consume(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    while (true) {
+        pthread_mutex_lock(&condvar.mutex);
+        while (sque_is_empty(condvar.queue) && !condvar.closed) {
+            pthread_cond_wait(&condvar.not_empty, &condvar.mutex);
+        }
+        if (sque_is_empty(condvar.queue)) {
+            pthread_mutex_unlock(&condvar.mutex);
+            return NULL;
+        }
+        sque_dequeue(&condvar.queue, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&condvar.mutex);
+    }
+}
+
+static void * bqueue_produce(void * args) {
+    (void)(args);
+    for (DATA_TYPE i = 0; i < count; ++i) {
+        bque_enqueue(&queue, &i, sizeof(DATA_TYPE));
+    }
+    bque_close(&queue);
+    return NULL;
+}
+
+static void * bqueue_consume(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    while (bque_dequeue_wait(&queue, &element, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE))) {}
+    return NULL;
+}
+
+static void * bqueue_consume_batch(void * args) {
+    (void)(args);
+    DATA_TYPE elements[BATCH];
+    while (bque_dequeue_batch_wait(&queue, elements, BATCH, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE))) {}
+    return NULL;
+}
+
+/// @brief Runs one producer and 'consumers' consumers and returns elapsed seconds.
+static double run(const size_t consumers, void * (*produce)(void *), void * (*consume)(void *)) {
+    pthread_t producer;
+    pthread_t * workers = malloc(consumers * sizeof(pthread_t));
+
+    const double start = seconds();
+    for (size_t i = 0; i < consumers; ++i) {
+        pthread_create(&workers[i], NULL, consume, NULL);
+    }
+    pthread_create(&producer, NULL, produce, NULL);
+    pthread_join(producer, NULL);
+    for (size_t i = 0; i < consumers; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(workers);
+    return elapsed;
+}
+
+/// Compares futex blocking queue, single and batch dequeue, with a condvar-signaled squeue as consumers increase.
+/// Usage: scale_concurrent_bqueue_benchmark [element count] [maximum consumers]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_consumers = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    printf("%-10s %-20s %-20s %-20s\n", "consumers", "condvar elements/s", "bqueue elements/s", "batch elements/s");
+    for (size_t consumers = 1; consumers <= max_consumers; consumers <<= 1) {
+        condvar = (condvar_queue_s) { .queue = sque_create(), .closed = false, };
+        pthread_mutex_init(&condvar.mutex, NULL);
+        pthread_cond_init(&condvar.not_empty, NULL);
+        const double condvar_time = run(consumers, condvar_produce, condvar_consume);
+        sque_destroy(&condvar.queue, destroy, sizeof(DATA_TYPE));
+        pthread_cond_destroy(&condvar.not_empty);
+        pthread_mutex_destroy(&condvar.mutex);
+
+        queue = bque_create();
+        const double bqueue_time = run(consumers, bqueue_produce, bqueue_consume);
+        bque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+
+        queue = bque_create();
+        const double batch_time = run(consumers, bqueue_produce, bqueue_consume_batch);
+        bque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+
+        printf("%-10zu %-20.0f %-20.0f %-20.0f\n", consumers, (double)count / condvar_time, (double)count / bqueue_time, (double)count / batch_time);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/stack/cstack.h>
+#include <scale/sequential/stack/sstack.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define CAPACITY (1 << 10)
+
+typedef struct locked_stack {
+    sstack_s stack;
+    pthread_mutex_t mutex;
+} locked_stack_s;
+
+static size_t count = 1 << 21;
+static size_t per_thread = 0;
+static locked_stack_s locked;
+static cstack_s stack;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * locked_push_pop(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        pthread_mutex_lock(&locked.mutex);
+        sstk_push(&locked.stack, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&locked.mutex);
+
+        pthread_mutex_lock(&locked.mutex);
+        sstk_pop(&locked.stack, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&locked.mutex);
+    }
+    return NULL;
+}
+
+static void * cstack_push_pop(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        while (!cstk_push(&stack, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        while (!cstk_pop(&stack, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/// @brief Runs 'threads' threads that each push and pop in pairs and returns elapsed seconds.
+static double run(const size_t threads, void * (*push_pop)(void *)) {
+    pthread_t * workers = malloc(threads * sizeof(pthread_t));
+    per_thread = count / threads;
+
+    const double start = seconds();
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&workers[i], NULL, push_pop, NULL);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(workers);
+    return elapsed;
+}
+
+/// Compares lock-free elimination stack with a mutex-wrapped sstack as threads doing push/pop pairs increase.
+/// Usage: scale_concurrent_cstack_benchmark [push/pop pair count] [maximum threads]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    locked.stack = sstk_create();
+    pthread_mutex_init(&locked.mutex, NULL);
+    stack = cstk_create(CAPACITY, sizeof(DATA_TYPE));
+
+    printf("%-8s %-20s %-20s\n", "threads", "mutex pairs/s", "cstack pairs/s");
+    for (size_t threads = 1; threads <= max_threads; threads <<= 1) {
+        const double locked_time = run(threads, locked_push_pop);
+        const double cstack_time = run(threads, cstack_push_pop);
+        const double total = (double)(per_thread * threads);
+        printf("%-8zu %-20.0f %-20.0f\n", threads, total / locked_time, total / cstack_time);
+    }
+
+    cstk_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    sstk_destroy(&locked.stack, destroy, sizeof(DATA_TYPE));
+    pthread_mutex_destroy(&locked.mutex);
+    return 0;
+}
\ No newline at end of file
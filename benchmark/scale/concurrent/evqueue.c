@@ -0,0 +1,150 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/evqueue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#define DATA_TYPE size_t
+#define BATCH (1 << 6)
+#define BACKLOG (1 << 16) // matches default pipe buffer, which bounds self-pipe producers
+
+typedef struct pipe_queue {
+    squeue_s queue;
+    pthread_mutex_t mutex;
+    int descriptors[2];
+} pipe_queue_s;
+
+static size_t count = 1 << 20;
+static size_t producers = 4;
+static pipe_queue_s piped;
+static evqueue_s queue;
+static size_t backlog; // elements enqueued into evqueue and not yet drained
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * pipe_produce(void * args) {
+    (void)(args);
+    const char byte = 0;
+    for (DATA_TYPE i = 0; i < count / producers; ++i) {
+        pthread_mutex_lock(&piped.mutex);
+        sque_enqueue(&piped.queue, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&piped.mutex);
+        if (write(piped.descriptors[1], &byte, sizeof(byte)) != sizeof(byte)) { // self-pipe wakes loop for every element
+            abort();
+        }
+    }
+    return NULL;
+}
+
+static size_t pipe_drain(void) {
+    char bytes[BATCH];
+    const ssize_t received = read(piped.descriptors[0], bytes, sizeof(bytes));
+    if (received <= 0) {
+        return 0;
+    }
+
+    DATA_TYPE element = 0;
+    pthread_mutex_lock(&piped.mutex);
+    for (ssize_t i = 0; i < received; ++i) {
+        sque_dequeue(&piped.queue, &element, sizeof(DATA_TYPE));
+    }
+    pthread_mutex_unlock(&piped.mutex);
+
+    return (size_t)received;
+}
+
+static void * evqueue_produce(void * args) {
+    (void)(args);
+    for (DATA_TYPE i = 0; i < count / producers; ++i) {
+        while (__atomic_load_n(&backlog, __ATOMIC_RELAXED) >= BACKLOG) { // back-pressure like a full pipe
+            sched_yield();
+        }
+        evque_enqueue(&queue, &i, sizeof(DATA_TYPE));
+        __atomic_fetch_add(&backlog, 1, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+static size_t evqueue_drain(void) {
+    DATA_TYPE elements[BATCH];
+    size_t total = 0, n = 0;
+    do { // drains until queue is empty, so one wakeup handles whole backlog
+        n = evque_dequeue_batch(&queue, elements, BATCH, sizeof(DATA_TYPE));
+        total += n;
+    } while (BATCH == n);
+    __atomic_fetch_sub(&backlog, total, __ATOMIC_RELAXED);
+    return total;
+}
+
+/// @brief Runs producers against an epoll loop on descriptor, prints throughput and loop wakeups per element.
+static void run(const char * name, const int descriptor, void * (*produce)(void *), size_t (*drain)(void)) {
+    const int loop = epoll_create1(0);
+    struct epoll_event event = { .events = EPOLLIN, };
+    epoll_ctl(loop, EPOLL_CTL_ADD, descriptor, &event);
+
+    pthread_t * threads = malloc(producers * sizeof(pthread_t));
+    const size_t total = (count / producers) * producers;
+    size_t wakeups = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < producers; ++i) {
+        pthread_create(&threads[i], NULL, produce, NULL);
+    }
+    for (size_t received = 0; received < total;) {
+        if (epoll_wait(loop, &event, 1, -1) == 1) {
+            wakeups++;
+            received += drain();
+        }
+    }
+    for (size_t i = 0; i < producers; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    printf("%-24s %12.0f elements/s %10.5f wakeups/element\n", name, (double)total / elapsed, (double)wakeups / (double)total);
+    free(threads);
+    close(loop);
+}
+
+/// Compares eventfd-signaled queue with a mutex squeue plus per-element self-pipe wakeups under an epoll loop.
+/// Usage: scale_concurrent_evqueue_benchmark [element count] [producer count]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        producers = strtoul(argv[2], NULL, 10);
+    }
+
+    piped = (pipe_queue_s) { .queue = sque_create(), };
+    pthread_mutex_init(&piped.mutex, NULL);
+    if (!pipe(piped.descriptors)) {
+        run("self-pipe squeue", piped.descriptors[0], pipe_produce, pipe_drain);
+        close(piped.descriptors[0]);
+        close(piped.descriptors[1]);
+    }
+    sque_destroy(&piped.queue, destroy, sizeof(DATA_TYPE));
+    pthread_mutex_destroy(&piped.mutex);
+
+    queue = evque_create();
+    if (-1 != queue.descriptor) {
+        run("eventfd queue", queue.descriptor, evqueue_produce, evqueue_drain);
+    }
+    evque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+
+    return 0;
+}
\ No newline at end of file
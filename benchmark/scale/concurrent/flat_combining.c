@@ -0,0 +1,163 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/stack/fcstack.h>
+#include <scale/concurrent/queue/fcqueue.h>
+#include <scale/concurrent/deque/fcdeque.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+
+static size_t count = 1 << 20;
+static size_t per_thread = 0;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static sstack_s locked_stack;
+static squeue_s locked_queue;
+static sdeque_s locked_deque;
+static fcstack_s stack;
+static fcqueue_s queue;
+static fcdeque_s deque;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * locked_stack_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        pthread_mutex_lock(&mutex);
+        sstk_push(&locked_stack, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+
+        pthread_mutex_lock(&mutex);
+        sstk_pop(&locked_stack, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void * fc_stack_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        fcstk_push(&stack, &i, sizeof(DATA_TYPE));
+        fcstk_pop(&stack, &element, sizeof(DATA_TYPE));
+    }
+    return NULL;
+}
+
+static void * locked_queue_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        pthread_mutex_lock(&mutex);
+        sque_enqueue(&locked_queue, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+
+        pthread_mutex_lock(&mutex);
+        sque_dequeue(&locked_queue, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void * fc_queue_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        fcque_enqueue(&queue, &i, sizeof(DATA_TYPE));
+        fcque_dequeue(&queue, &element, sizeof(DATA_TYPE));
+    }
+    return NULL;
+}
+
+static void * locked_deque_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        pthread_mutex_lock(&mutex);
+        sdeq_enqueue_front(&locked_deque, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+
+        pthread_mutex_lock(&mutex);
+        sdeq_dequeue_rear(&locked_deque, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void * fc_deque_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        fcdeq_enqueue_front(&deque, &i, sizeof(DATA_TYPE));
+        fcdeq_dequeue_rear(&deque, &element, sizeof(DATA_TYPE));
+    }
+    return NULL;
+}
+
+/// @brief Runs 'threads' threads that each insert and remove in pairs and returns elapsed seconds.
+static double run(const size_t threads, void * (*pairs)(void *)) {
+    pthread_t * workers = malloc(threads * sizeof(pthread_t));
+    per_thread = count / threads;
+
+    const double start = seconds();
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&workers[i], NULL, pairs, NULL);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(workers);
+    return elapsed;
+}
+
+/// Compares flat-combining stack, queue and deque with their mutex-wrapped sequential versions as threads increase.
+/// Usage: scale_concurrent_flat_combining_benchmark [pair count] [maximum threads]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    locked_stack = sstk_create();
+    locked_queue = sque_create();
+    locked_deque = sdeq_create();
+    stack = fcstk_create();
+    queue = fcque_create();
+    deque = fcdeq_create();
+
+    printf("%-8s %-16s %-16s %-16s %-16s %-16s %-16s\n", "threads", "mutex stack/s", "fc stack/s", "mutex queue/s", "fc queue/s", "mutex deque/s", "fc deque/s");
+    for (size_t threads = 1; threads <= max_threads; threads <<= 1) {
+        const double locked_stack_time = run(threads, locked_stack_pairs);
+        const double stack_time = run(threads, fc_stack_pairs);
+        const double locked_queue_time = run(threads, locked_queue_pairs);
+        const double queue_time = run(threads, fc_queue_pairs);
+        const double locked_deque_time = run(threads, locked_deque_pairs);
+        const double deque_time = run(threads, fc_deque_pairs);
+        const double total = (double)(per_thread * threads);
+        printf("%-8zu %-16.0f %-16.0f %-16.0f %-16.0f %-16.0f %-16.0f\n", threads,
+            total / locked_stack_time, total / stack_time, total / locked_queue_time, total / queue_time,
+            total / locked_deque_time, total / deque_time);
+    }
+
+    fcdeq_destroy(&deque, destroy, sizeof(DATA_TYPE));
+    fcque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    fcstk_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    sdeq_destroy(&locked_deque, destroy, sizeof(DATA_TYPE));
+    sque_destroy(&locked_queue, destroy, sizeof(DATA_TYPE));
+    sstk_destroy(&locked_stack, destroy, sizeof(DATA_TYPE));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/mpmcqueue.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define CAPACITY (1 << 10)
+
+typedef struct locked_queue {
+    squeue_s queue;
+    pthread_mutex_t mutex;
+} locked_queue_s;
+
+static size_t count = 1 << 21;
+static size_t per_thread = 0;
+static locked_queue_s locked;
+static mpmcqueue_s queue;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * locked_produce(void * args) {
+    (void)(args);
+    for (DATA_TYPE i = 0; i < per_thread;) {
+        pthread_mutex_lock(&locked.mutex);
+        const bool has_space = locked.queue.size < CAPACITY; // bound queue like the ring to compare fairly
+        if (has_space) {
+            sque_enqueue(&locked.queue, &i, sizeof(DATA_TYPE));
+            i++;
+        }
+        pthread_mutex_unlock(&locked.mutex);
+
+        if (!has_space) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * locked_consume(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (size_t i = 0; i < per_thread;) {
+        pthread_mutex_lock(&locked.mutex);
+        const bool has_element = !sque_is_empty(locked.queue);
+        if (has_element) {
+            sque_dequeue(&locked.queue, &element, sizeof(DATA_TYPE));
+            i++;
+        }
+        pthread_mutex_unlock(&locked.mutex);
+
+        if (!has_element) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * mpmc_produce(void * args) {
+    (void)(args);
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        mpmc_enqueue(&queue, &i, sizeof(DATA_TYPE));
+    }
+    return NULL;
+}
+
+static void * mpmc_consume(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (size_t i = 0; i < per_thread; ++i) {
+        mpmc_dequeue(&queue, &element, sizeof(DATA_TYPE));
+    }
+    return NULL;
+}
+
+/// @brief Runs 'threads' producers and 'threads' consumers and returns elapsed seconds.
+static double run(const size_t threads, void * (*produce)(void *), void * (*consume)(void *)) {
+    pthread_t * producers = malloc(threads * sizeof(pthread_t));
+    pthread_t * consumers = malloc(threads * sizeof(pthread_t));
+    per_thread = count / threads;
+
+    const double start = seconds();
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&producers[i], NULL, produce, NULL);
+        pthread_create(&consumers[i], NULL, consume, NULL);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(producers);
+    free(consumers);
+    return elapsed;
+}
+
+/// Compares bounded MPMC queue with a mutex-wrapped squeue as producer/consumer pairs increase.
+/// Usage: scale_concurrent_mpmc_queue_benchmark [element count] [maximum producer/consumer pairs]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    locked.queue = sque_create();
+    pthread_mutex_init(&locked.mutex, NULL);
+    queue = mpmc_create(CAPACITY, sizeof(DATA_TYPE));
+
+    printf("%-8s %-20s %-20s\n", "pairs", "mutex elements/s", "mpmc elements/s");
+    for (size_t threads = 1; threads <= max_threads; threads <<= 1) {
+        const double locked_time = run(threads, locked_produce, locked_consume);
+        const double mpmc_time = run(threads, mpmc_produce, mpmc_consume);
+        const double total = (double)(per_thread * threads);
+        printf("%-8zu %-20.0f %-20.0f\n", threads, total / locked_time, total / mpmc_time);
+    }
+
+    mpmc_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    sque_destroy(&locked.queue, destroy, sizeof(DATA_TYPE));
+    pthread_mutex_destroy(&locked.mutex);
+    return 0;
+}
\ No newline at end of file
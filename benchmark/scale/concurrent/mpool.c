@@ -0,0 +1,110 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/pool/mpool.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define MAGAZINE_SIZE (1 << 5)
+#define BURST (1 << 6)
+
+static size_t count = 1 << 21;
+static size_t per_thread = 0;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static sstack_s locked;
+static mpool_s pool;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * locked_get_put(void * args) {
+    (void)(args);
+    DATA_TYPE objects[BURST];
+    for (size_t i = 0; i < per_thread; i += BURST) {
+        for (size_t j = 0; j < BURST; ++j) {
+            pthread_mutex_lock(&mutex);
+            if (sstk_is_empty(locked)) {
+                objects[j] = j; // stands in for allocating a new object
+            } else {
+                sstk_pop(&locked, &objects[j], sizeof(DATA_TYPE));
+            }
+            pthread_mutex_unlock(&mutex);
+        }
+        for (size_t j = 0; j < BURST; ++j) {
+            pthread_mutex_lock(&mutex);
+            sstk_push(&locked, &objects[j], sizeof(DATA_TYPE));
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+    return NULL;
+}
+
+static void * mpool_get_put(void * args) {
+    (void)(args);
+    DATA_TYPE objects[BURST];
+    mpool_cache_s cache = mpool_cache_create();
+    for (size_t i = 0; i < per_thread; i += BURST) {
+        for (size_t j = 0; j < BURST; ++j) {
+            if (!mpool_get(&pool, &cache, &objects[j], sizeof(DATA_TYPE))) {
+                objects[j] = j; // stands in for allocating a new object
+            }
+        }
+        for (size_t j = 0; j < BURST; ++j) {
+            mpool_put(&pool, &cache, &objects[j], sizeof(DATA_TYPE));
+        }
+    }
+    mpool_cache_destroy(&pool, &cache, sizeof(DATA_TYPE));
+    return NULL;
+}
+
+/// @brief Runs 'threads' threads that get and put objects in bursts and returns elapsed seconds.
+static double run(const size_t threads, void * (*get_put)(void *)) {
+    pthread_t * workers = malloc(threads * sizeof(pthread_t));
+    per_thread = count / threads;
+
+    const double start = seconds();
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&workers[i], NULL, get_put, NULL);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(workers);
+    return elapsed;
+}
+
+/// Compares magazine pool with a mutex-wrapped sstack free list as threads increase.
+/// Usage: scale_concurrent_mpool_benchmark [get/put pair count] [maximum threads]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    locked = sstk_create();
+    pool = mpool_create(MAGAZINE_SIZE);
+
+    printf("%-8s %-20s %-20s\n", "threads", "mutex pairs/s", "mpool pairs/s");
+    for (size_t threads = 1; threads <= max_threads; threads <<= 1) {
+        const double locked_time = run(threads, locked_get_put);
+        const double mpool_time = run(threads, mpool_get_put);
+        const double total = (double)(per_thread * threads);
+        printf("%-8zu %-20.0f %-20.0f\n", threads, total / locked_time, total / mpool_time);
+    }
+
+    mpool_destroy(&pool, destroy, sizeof(DATA_TYPE));
+    sstk_destroy(&locked, destroy, sizeof(DATA_TYPE));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/mqueue.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define SHARDS_PER_THREAD 2
+
+static size_t count = 1 << 21;
+static size_t per_thread = 0;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static squeue_s locked;
+static mqueue_s queue;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void * locked_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        pthread_mutex_lock(&mutex);
+        sque_enqueue(&locked, &i, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+
+        pthread_mutex_lock(&mutex);
+        sque_dequeue(&locked, &element, sizeof(DATA_TYPE));
+        pthread_mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void * mqueue_pairs(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (DATA_TYPE i = 0; i < per_thread; ++i) {
+        mque_enqueue(&queue, &i, sizeof(DATA_TYPE));
+        while (!mque_dequeue(&queue, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/// @brief Runs 'threads' threads that each enqueue and dequeue in pairs and returns elapsed seconds.
+static double run(const size_t threads, void * (*pairs)(void *)) {
+    pthread_t * workers = malloc(threads * sizeof(pthread_t));
+    per_thread = count / threads;
+
+    const double start = seconds();
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&workers[i], NULL, pairs, NULL);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    const double elapsed = seconds() - start;
+
+    free(workers);
+    return elapsed;
+}
+
+/// @brief Measures how many older elements are still queued whenever an element is dequeued.
+/// @param shard_count Number of shards in measured queue.
+/// @param n Number of measured elements.
+/// @param mean Mean rank error.
+/// @param max Maximum rank error.
+static void rank_error(const size_t shard_count, const size_t n, double * mean, size_t * max) {
+    mqueue_s measured = mque_create(shard_count, sizeof(DATA_TYPE));
+    size_t * tree = calloc(n + 1, sizeof(size_t)); // fenwick tree of elements still in queue
+
+    for (DATA_TYPE i = 0; i < n; ++i) {
+        mque_enqueue(&measured, &i, sizeof(DATA_TYPE));
+        for (size_t j = i + 1; j <= n; j += j & (~j + 1)) {
+            tree[j]++;
+        }
+    }
+
+    size_t total = 0;
+    (*max) = 0;
+    for (DATA_TYPE element = 0; mque_dequeue(&measured, &element, sizeof(DATA_TYPE));) {
+        size_t older = 0;
+        for (size_t j = element; j; j -= j & (~j + 1)) {
+            older += tree[j];
+        }
+        for (size_t j = element + 1; j <= n; j += j & (~j + 1)) {
+            tree[j]--;
+        }
+
+        total += older;
+        if (older > (*max)) {
+            (*max) = older;
+        }
+    }
+    (*mean) = (double)total / (double)n;
+
+    free(tree);
+    mque_destroy(&measured, destroy, sizeof(DATA_TYPE));
+}
+
+/// Compares sharded multi-queue with a single mutex-wrapped squeue as threads increase, and reports rank error.
+/// Usage: scale_concurrent_mqueue_benchmark [pair count] [maximum threads]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+    locked = sque_create();
+
+    printf("%-8s %-8s %-20s %-20s %-16s %-16s\n", "threads", "shards", "mutex pairs/s", "mqueue pairs/s", "mean rank error", "max rank error");
+    for (size_t threads = 1; threads <= max_threads; threads <<= 1) {
+        const size_t shard_count = threads * SHARDS_PER_THREAD;
+        queue = mque_create(shard_count, sizeof(DATA_TYPE));
+
+        const double locked_time = run(threads, locked_pairs);
+        const double mqueue_time = run(threads, mqueue_pairs);
+        const double total = (double)(per_thread * threads);
+
+        double mean = 0.0;
+        size_t max = 0;
+        rank_error(shard_count, count < (1 << 20) ? count : (1 << 20), &mean, &max);
+
+        printf("%-8zu %-8zu %-20.0f %-20.0f %-16.2f %-16zu\n", threads, shard_count, total / locked_time, total / mqueue_time, mean, max);
+        mque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    }
+
+    sque_destroy(&locked, destroy, sizeof(DATA_TYPE));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/shmqueue.h>
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#define CAPACITY (1 << 10)
+#define BATCH (1 << 6)
+#define SEGMENT_NAME "/normads_shmqueue_benchmark"
+
+typedef struct record {
+    size_t sequence;
+    char payload[56];
+} record_s;
+
+static size_t count = 1 << 21;
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// Writes whole buffer into descriptor, retrying short writes.
+static void write_all(const int descriptor, const char * buffer, size_t size) {
+    while (size) {
+        const ssize_t written = write(descriptor, buffer, size);
+        if (written <= 0) {
+            _exit(EXIT_FAILURE);
+        }
+        buffer += written;
+        size -= (size_t)written;
+    }
+}
+
+/// Reads whole buffer from descriptor, retrying short reads.
+static void read_all(const int descriptor, char * buffer, size_t size) {
+    while (size) {
+        const ssize_t received = read(descriptor, buffer, size);
+        if (received <= 0) {
+            _exit(EXIT_FAILURE);
+        }
+        buffer += received;
+        size -= (size_t)received;
+    }
+}
+
+/// Consumes records from descriptor in child process, exits with failure on out of order record.
+static void descriptor_consume(const int descriptor) {
+    record_s batch[BATCH];
+    size_t expected = 0;
+    for (size_t received = 0; received < count; received += BATCH) {
+        const size_t n = count - received < BATCH ? count - received : BATCH;
+        read_all(descriptor, (char*)batch, n * sizeof(record_s));
+        for (size_t j = 0; j < n; ++j, ++expected) {
+            if (batch[j].sequence != expected) {
+                _exit(EXIT_FAILURE);
+            }
+        }
+    }
+    _exit(EXIT_SUCCESS);
+}
+
+/// Produces records into descriptor in parent process.
+static void descriptor_produce(const int descriptor) {
+    record_s batch[BATCH];
+    memset(batch, 0, sizeof(batch));
+    for (size_t sent = 0; sent < count; sent += BATCH) {
+        const size_t n = count - sent < BATCH ? count - sent : BATCH;
+        for (size_t j = 0; j < n; ++j) {
+            batch[j].sequence = sent + j;
+        }
+        write_all(descriptor, (char*)batch, n * sizeof(record_s));
+    }
+}
+
+/// Consumes records from shared memory ring in child process, exits with failure on out of order record.
+static void shmqueue_consume(void) {
+    shmqueue_s queue = shmq_attach(SEGMENT_NAME, sizeof(record_s));
+    if (!queue.header) {
+        _exit(EXIT_FAILURE);
+    }
+
+    record_s batch[BATCH];
+    size_t expected = 0;
+    for (size_t received = 0; received < count;) {
+        const size_t n = shmq_dequeue_n(&queue, batch, BATCH, sizeof(record_s));
+        for (size_t j = 0; j < n; ++j, ++expected) {
+            if (batch[j].sequence != expected) {
+                _exit(EXIT_FAILURE);
+            }
+        }
+        received += n;
+        if (!n) {
+            sched_yield();
+        }
+    }
+    shmq_detach(&queue);
+    _exit(EXIT_SUCCESS);
+}
+
+/// Produces records into shared memory ring in parent process.
+static void shmqueue_produce(shmqueue_s * queue) {
+    record_s batch[BATCH];
+    memset(batch, 0, sizeof(batch));
+    for (size_t i = 0; i < count; i += BATCH) {
+        const size_t n = count - i < BATCH ? count - i : BATCH;
+        for (size_t j = 0; j < n; ++j) {
+            batch[j].sequence = i + j;
+        }
+        for (size_t sent = 0; sent < n;) {
+            sent += shmq_enqueue_n(queue, batch + sent, n - sent, sizeof(record_s));
+            if (sent < n) {
+                sched_yield();
+            }
+        }
+    }
+}
+
+/// Waits for child consumer and prints throughput since start.
+static void report(const char * name, const pid_t child, const double start) {
+    int status = 0;
+    waitpid(child, &status, 0);
+    const double elapsed = seconds() - start;
+    if (!WIFEXITED(status) || EXIT_SUCCESS != WEXITSTATUS(status)) {
+        printf("%-24s %12s\n", name, "failed");
+        return;
+    }
+    printf("%-24s %12.0f records/s\n", name, (double)count / elapsed);
+}
+
+/// Compares shared memory ring with a pipe and a UNIX socket pair between two processes.
+/// Usage: scale_concurrent_shmqueue_benchmark [record count]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    printf("throughput, %zu records of %zu bytes:\n", count, sizeof(record_s));
+
+    int descriptors[2];
+    if (!pipe(descriptors)) {
+        const double start = seconds();
+        const pid_t child = fork();
+        if (!child) {
+            close(descriptors[1]);
+            descriptor_consume(descriptors[0]);
+        }
+        close(descriptors[0]);
+        descriptor_produce(descriptors[1]);
+        close(descriptors[1]);
+        report("pipe", child, start);
+    }
+
+    if (!socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors)) {
+        const double start = seconds();
+        const pid_t child = fork();
+        if (!child) {
+            close(descriptors[1]);
+            descriptor_consume(descriptors[0]);
+        }
+        close(descriptors[0]);
+        descriptor_produce(descriptors[1]);
+        close(descriptors[1]);
+        report("unix socket", child, start);
+    }
+
+    shmqueue_s queue = shmq_create(SEGMENT_NAME, CAPACITY, sizeof(record_s));
+    if (queue.header) {
+        const double start = seconds();
+        const pid_t child = fork();
+        if (!child) {
+            shmqueue_consume();
+        }
+        shmqueue_produce(&queue);
+        report("shm ring batch", child, start);
+        shmq_detach(&queue);
+        shmq_unlink(SEGMENT_NAME);
+    }
+
+    return 0;
+}
\ No newline at end of file
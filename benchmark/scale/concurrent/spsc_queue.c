@@ -0,0 +1,233 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/queue/spscqueue.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define CAPACITY (1 << 10)
+#define BATCH (1 << 6)
+
+typedef struct locked_queue {
+    squeue_s queue;
+    pthread_mutex_t mutex;
+} locked_queue_s;
+
+static size_t count = 1 << 22;
+static size_t round_trips = 1 << 16;
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static bool locked_enqueue(locked_queue_s * locked, const DATA_TYPE element) {
+    pthread_mutex_lock(&locked->mutex);
+    const bool has_space = locked->queue.size < CAPACITY; // bound queue like the ring to compare fairly
+    if (has_space) {
+        sque_enqueue(&locked->queue, &element, sizeof(DATA_TYPE));
+    }
+    pthread_mutex_unlock(&locked->mutex);
+
+    return has_space;
+}
+
+static bool locked_dequeue(locked_queue_s * locked, DATA_TYPE * element) {
+    pthread_mutex_lock(&locked->mutex);
+    const bool has_element = !sque_is_empty(locked->queue);
+    if (has_element) {
+        sque_dequeue(&locked->queue, element, sizeof(DATA_TYPE));
+    }
+    pthread_mutex_unlock(&locked->mutex);
+
+    return has_element;
+}
+
+static void * locked_produce(void * locked) {
+    for (DATA_TYPE i = 0; i < count; ++i) {
+        while (!locked_enqueue(locked, i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * spsc_produce(void * queue) {
+    for (DATA_TYPE i = 0; i < count; ++i) {
+        while (!spsc_enqueue(queue, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * spsc_produce_batch(void * queue) {
+    DATA_TYPE batch[BATCH];
+    for (DATA_TYPE i = 0; i < count; i += BATCH) {
+        const size_t n = count - i < BATCH ? count - i : BATCH;
+        for (size_t j = 0; j < n; ++j) {
+            batch[j] = i + j;
+        }
+        for (size_t sent = 0; sent < n;) {
+            sent += spsc_enqueue_n(queue, batch + sent, n - sent, sizeof(DATA_TYPE));
+            if (sent < n) {
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void throughput(void) {
+    locked_queue_s locked = { .queue = sque_create(), };
+    pthread_mutex_init(&locked.mutex, NULL);
+    spscqueue_s queue = spsc_create(CAPACITY, sizeof(DATA_TYPE));
+    pthread_t producer;
+    DATA_TYPE element = 0, sum = 0;
+
+    double start = seconds();
+    pthread_create(&producer, NULL, locked_produce, &locked);
+    for (size_t i = 0; i < count; ++i) {
+        while (!locked_dequeue(&locked, &element)) {
+            sched_yield();
+        }
+        sum += element;
+    }
+    pthread_join(producer, NULL);
+    printf("%-24s %12.0f elements/s\n", "mutex squeue", (double)count / (seconds() - start));
+
+    start = seconds();
+    pthread_create(&producer, NULL, spsc_produce, &queue);
+    for (size_t i = 0; i < count; ++i) {
+        while (!spsc_dequeue(&queue, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        sum += element;
+    }
+    pthread_join(producer, NULL);
+    printf("%-24s %12.0f elements/s\n", "spsc queue", (double)count / (seconds() - start));
+
+    DATA_TYPE batch[BATCH];
+    start = seconds();
+    pthread_create(&producer, NULL, spsc_produce_batch, &queue);
+    for (size_t received = 0; received < count;) {
+        const size_t n = spsc_dequeue_n(&queue, batch, BATCH, sizeof(DATA_TYPE));
+        for (size_t j = 0; j < n; ++j) {
+            sum += batch[j];
+        }
+        received += n;
+        if (!n) {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    printf("%-24s %12.0f elements/s\n", "spsc queue batch", (double)count / (seconds() - start));
+
+    printf("(checksum %zu)\n", sum);
+    spsc_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    sque_destroy(&locked.queue, destroy, sizeof(DATA_TYPE));
+    pthread_mutex_destroy(&locked.mutex);
+}
+
+static locked_queue_s locked_ping, locked_pong;
+static spscqueue_s spsc_ping, spsc_pong;
+
+static void * locked_echo(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (size_t i = 0; i < round_trips; ++i) {
+        while (!locked_dequeue(&locked_ping, &element)) {
+            sched_yield();
+        }
+        while (!locked_enqueue(&locked_pong, element)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * spsc_echo(void * args) {
+    (void)(args);
+    DATA_TYPE element = 0;
+    for (size_t i = 0; i < round_trips; ++i) {
+        while (!spsc_dequeue(&spsc_ping, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        while (!spsc_enqueue(&spsc_pong, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void latency(void) {
+    locked_ping = (locked_queue_s) { .queue = sque_create(), };
+    locked_pong = (locked_queue_s) { .queue = sque_create(), };
+    pthread_mutex_init(&locked_ping.mutex, NULL);
+    pthread_mutex_init(&locked_pong.mutex, NULL);
+    spsc_ping = spsc_create(CAPACITY, sizeof(DATA_TYPE));
+    spsc_pong = spsc_create(CAPACITY, sizeof(DATA_TYPE));
+    pthread_t echo;
+    DATA_TYPE element = 0;
+
+    double start = seconds();
+    pthread_create(&echo, NULL, locked_echo, NULL);
+    for (DATA_TYPE i = 0; i < round_trips; ++i) {
+        while (!locked_enqueue(&locked_ping, i)) {
+            sched_yield();
+        }
+        while (!locked_dequeue(&locked_pong, &element)) {
+            sched_yield();
+        }
+    }
+    pthread_join(echo, NULL);
+    printf("%-24s %12.0f ns/round trip\n", "mutex squeue", (seconds() - start) * 1e9 / (double)round_trips);
+
+    start = seconds();
+    pthread_create(&echo, NULL, spsc_echo, NULL);
+    for (DATA_TYPE i = 0; i < round_trips; ++i) {
+        while (!spsc_enqueue(&spsc_ping, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        while (!spsc_dequeue(&spsc_pong, &element, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+    pthread_join(echo, NULL);
+    printf("%-24s %12.0f ns/round trip\n", "spsc queue", (seconds() - start) * 1e9 / (double)round_trips);
+
+    spsc_destroy(&spsc_ping, destroy, sizeof(DATA_TYPE));
+    spsc_destroy(&spsc_pong, destroy, sizeof(DATA_TYPE));
+    sque_destroy(&locked_ping.queue, destroy, sizeof(DATA_TYPE));
+    sque_destroy(&locked_pong.queue, destroy, sizeof(DATA_TYPE));
+    pthread_mutex_destroy(&locked_ping.mutex);
+    pthread_mutex_destroy(&locked_pong.mutex);
+}
+
+/// Compares single-producer/single-consumer ring with a mutex-wrapped squeue.
+/// Usage: scale_concurrent_spsc_queue_benchmark [element count] [round trip count]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        round_trips = strtoul(argv[2], NULL, 10);
+    }
+
+    printf("throughput, %zu elements:\n", count);
+    throughput();
+    printf("latency, %zu round trips:\n", round_trips);
+    latency();
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/concurrent/pool/tpool.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DATA_TYPE size_t
+#define FIBONACCI_CUTOFF 16
+#define SORT_CUTOFF (1 << 12)
+#define SUM_GRAIN (1 << 14)
+
+static size_t count = 1 << 22;
+static int fibonacci_n = 32;
+static tpool_s pool;
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static long fibonacci_sequential(const int n) {
+    return n < 2 ? n : fibonacci_sequential(n - 1) + fibonacci_sequential(n - 2);
+}
+
+struct fibonacci {
+    int n;
+    long result;
+};
+
+static void fibonacci(void * argument) {
+    struct fibonacci * fib = argument;
+    if (fib->n < FIBONACCI_CUTOFF) {
+        fib->result = fibonacci_sequential(fib->n);
+        return;
+    }
+
+    struct fibonacci left = { .n = fib->n - 1, }, right = { .n = fib->n - 2, };
+    tpool_group_s group = tpool_group_create();
+    tpool_spawn(pool, &group, fibonacci, &left);
+    fibonacci(&right);
+    tpool_wait(pool, &group);
+
+    fib->result = left.result + right.result;
+}
+
+struct sum {
+    const DATA_TYPE * elements;
+    DATA_TYPE total;
+};
+
+static void sum_range(size_t begin, size_t end, void * argument) {
+    struct sum * sum = argument;
+    DATA_TYPE partial = 0;
+    for (size_t i = begin; i < end; ++i) {
+        partial += sum->elements[i];
+    }
+    __atomic_fetch_add(&sum->total, partial, __ATOMIC_RELAXED);
+}
+
+static int compare(const void * a, const void * b) {
+    const DATA_TYPE x = *(const DATA_TYPE*)a, y = *(const DATA_TYPE*)b;
+    return (x > y) - (x < y);
+}
+
+struct sort {
+    DATA_TYPE * elements;
+    DATA_TYPE * temporary;
+    size_t n;
+};
+
+static void sort(void * argument) {
+    struct sort * range = argument;
+    if (range->n <= SORT_CUTOFF) {
+        qsort(range->elements, range->n, sizeof(DATA_TYPE), compare);
+        return;
+    }
+
+    const size_t half = range->n / 2;
+    struct sort left = { .elements = range->elements, .temporary = range->temporary, .n = half, };
+    struct sort right = { .elements = range->elements + half, .temporary = range->temporary + half, .n = range->n - half, };
+    tpool_group_s group = tpool_group_create();
+    tpool_spawn(pool, &group, sort, &left);
+    sort(&right);
+    tpool_wait(pool, &group);
+
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < range->n) {
+        range->temporary[k++] = range->elements[i] <= range->elements[j] ? range->elements[i++] : range->elements[j++];
+    }
+    while (i < half) {
+        range->temporary[k++] = range->elements[i++];
+    }
+    while (j < range->n) {
+        range->temporary[k++] = range->elements[j++];
+    }
+    memcpy(range->elements, range->temporary, range->n * sizeof(DATA_TYPE));
+}
+
+/// @brief Runs task on pool through a group and waits for it.
+static void run(const task_fn task, void * argument) {
+    tpool_group_s group = tpool_group_create();
+    tpool_spawn(pool, &group, task, argument);
+    tpool_wait(pool, &group);
+}
+
+/// Measures fork/join fibonacci, parallel-for sum and fork/join merge sort on work-stealing pool as workers increase.
+/// Usage: scale_concurrent_tpool_benchmark [element count] [fibonacci n] [maximum workers]
+int main(const int argc, char **argv) {
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        fibonacci_n = (int)strtol(argv[2], NULL, 10);
+    }
+    const size_t max_workers = argc > 3 ? strtoul(argv[3], NULL, 10) : 16;
+
+    DATA_TYPE * elements = malloc(count * sizeof(DATA_TYPE));
+    DATA_TYPE * shuffled = malloc(count * sizeof(DATA_TYPE));
+    DATA_TYPE * temporary = malloc(count * sizeof(DATA_TYPE));
+    srand(42);
+    for (size_t i = 0; i < count; ++i) {
+        shuffled[i] = (DATA_TYPE)rand();
+    }
+
+    double start = seconds();
+    const long expected = fibonacci_sequential(fibonacci_n);
+    const double fibonacci_time = seconds() - start;
+
+    struct sum serial = { .elements = shuffled, .total = 0, };
+    start = seconds();
+    sum_range(0, count, &serial);
+    const double sum_time = seconds() - start;
+
+    memcpy(elements, shuffled, count * sizeof(DATA_TYPE));
+    start = seconds();
+    qsort(elements, count, sizeof(DATA_TYPE), compare);
+    const double sort_time = seconds() - start;
+
+    printf("%-8s %-16s %-16s %-16s\n", "workers", "fibonacci s", "sum s", "sort s");
+    printf("%-8s %-16.4f %-16.4f %-16.4f\n", "serial", fibonacci_time, sum_time, sort_time);
+    for (size_t workers = 1; workers <= max_workers; workers <<= 1) {
+        pool = tpool_create(workers);
+
+        struct fibonacci fib = { .n = fibonacci_n, };
+        start = seconds();
+        run(fibonacci, &fib);
+        const double fibonacci_pool = seconds() - start;
+
+        struct sum sum = { .elements = shuffled, .total = 0, };
+        start = seconds();
+        tpool_parallel_for(pool, 0, count, SUM_GRAIN, sum_range, &sum);
+        const double sum_pool = seconds() - start;
+
+        memcpy(elements, shuffled, count * sizeof(DATA_TYPE));
+        struct sort range = { .elements = elements, .temporary = temporary, .n = count, };
+        start = seconds();
+        run(sort, &range);
+        const double sort_pool = seconds() - start;
+
+        if (sum.total != serial.total) {
+            fprintf(stderr, "sum mismatch: %zu != %zu\n", sum.total, serial.total);
+        }
+        if (fib.result != expected) {
+            fprintf(stderr, "fibonacci mismatch: %ld != %ld\n", fib.result, expected);
+        }
+        for (size_t i = 1; i < count; ++i) {
+            if (elements[i - 1] > elements[i]) {
+                fprintf(stderr, "sort mismatch at %zu\n", i);
+                break;
+            }
+        }
+
+        printf("%-8zu %-16.4f %-16.4f %-16.4f\n", workers, fibonacci_pool, sum_pool, sort_pool);
+        tpool_destroy(&pool);
+    }
+
+    free(temporary);
+    free(shuffled);
+    free(elements);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/queue/saqueue.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE unsigned
+
+static unsigned long long checksum = 0; // sum of window aggregates, keeps queries from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static DATA_TYPE gcd(DATA_TYPE a, DATA_TYPE b) {
+    while (b) {
+        const DATA_TYPE remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+static void combine(void * left, const void * right) {
+    DATA_TYPE * convert_left = left;
+    const DATA_TYPE * convert_right = right;
+    (*convert_left) = gcd(*convert_left, *convert_right);
+}
+
+static bool accumulate(void * element, const size_t size, void * args) {
+    combine(args, element);
+    (void)(size);
+    return true;
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Keeps last 'window' samples in a queue and recomputes their gcd with 'sque_foreach' on every tick.
+static double recompute(DATA_TYPE const * samples, const size_t count, const size_t window) {
+    squeue_s queue = sque_create();
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        sque_enqueue(&queue, &samples[i], sizeof(DATA_TYPE));
+        if (queue.size > window) {
+            sque_dequeue(&queue, &element, sizeof(DATA_TYPE));
+        }
+
+        DATA_TYPE aggregate = 0; // gcd's identity
+        sque_foreach(&queue, accumulate, sizeof(DATA_TYPE), &aggregate);
+        checksum += aggregate;
+    }
+    const double elapsed = seconds() - start;
+
+    sque_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// @brief Keeps last 'window' samples in an aggregation queue and queries its gcd on every tick.
+static double aggregate(DATA_TYPE const * samples, const size_t count, const size_t window) {
+    saqueue_s queue = saqu_create(combine, sizeof(DATA_TYPE));
+    DATA_TYPE element = 0, result = 0;
+    size_t size = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        saqu_enqueue(&queue, &samples[i], sizeof(DATA_TYPE));
+        if (++size > window) {
+            saqu_dequeue(&queue, &element, sizeof(DATA_TYPE));
+            size--;
+        }
+
+        saqu_aggregate(queue, &result, sizeof(DATA_TYPE));
+        checksum += result;
+    }
+    const double elapsed = seconds() - start;
+
+    saqu_destroy(&queue, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// Compares sliding-window gcd recomputed with 'sque_foreach' on every tick against a two-stack aggregation queue.
+/// Usage: scale_sequential_aggregate_queue_benchmark [sample count] [maximum window]
+int main(const int argc, char **argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 18);
+    const size_t max_window = argc > 2 ? strtoul(argv[2], NULL, 10) : (1 << 10);
+
+    DATA_TYPE * samples = malloc(count * sizeof(DATA_TYPE));
+    srand(42);
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = (DATA_TYPE)(rand() % 64) * 720; // shared factor keeps gcd from collapsing to one
+    }
+
+    printf("%-8s %-18s %-18s\n", "window", "recompute seconds", "aggregate seconds");
+    for (size_t window = 4; window <= max_window; window <<= 2) {
+        const double recompute_time = recompute(samples, count, window);
+        const double aggregate_time = aggregate(samples, count, window);
+        printf("%-8zu %-18.4f %-18.4f\n", window, recompute_time, aggregate_time);
+    }
+    printf("(checksum %llu)\n", checksum);
+
+    free(samples);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/stack/sstack.h>
+#include <scale/sequential/stack/sbstack.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LENGTH 64
+
+typedef struct pointer {
+    char * blob; // separately allocated blob
+    size_t length; // number of bytes in blob
+} pointer_s;
+
+static uint64_t checksum = 0; // sum of popped blobs' last bytes, keeps pops from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Pushes pointers to separately allocated blobs, then pops and frees each of them.
+static double pointers(const size_t count, char const * bytes) {
+    sstack_s stack = sstk_create();
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        const size_t length = (i % MAX_LENGTH) + 1;
+        pointer_s pointer = { .blob = malloc(length), .length = length, };
+        memcpy(pointer.blob, bytes + (i % MAX_LENGTH), length);
+        sstk_push(&stack, &pointer, sizeof(pointer_s));
+    }
+    while (!sstk_is_empty(stack)) {
+        pointer_s pointer = { 0 };
+        sstk_pop(&stack, &pointer, sizeof(pointer_s));
+        checksum += (unsigned char)pointer.blob[pointer.length - 1];
+        free(pointer.blob);
+    }
+    const double elapsed = seconds() - start;
+
+    sstk_destroy(&stack, destroy, sizeof(pointer_s));
+    return elapsed;
+}
+
+/// @brief Pushes blobs inline into a single buffer, then pops each of them in place.
+static double blobs(const size_t count, char const * bytes) {
+    sbstack_s stack = sbst_create();
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        sbst_push(&stack, bytes + (i % MAX_LENGTH), (i % MAX_LENGTH) + 1);
+    }
+    while (!sbst_is_empty(stack)) {
+        size_t length = 0;
+        unsigned char const * blob = sbst_pop(&stack, &length);
+        checksum += blob[length - 1];
+    }
+    const double elapsed = seconds() - start;
+
+    sbst_destroy(&stack, destroy);
+    return elapsed;
+}
+
+/// Compares pushing and popping small variable length blobs as separately allocated pointers and inline in a buffer.
+/// Usage: scale_sequential_blob_stack_benchmark [max blob count]
+int main(const int argc, char **argv) {
+    const size_t max_count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 22);
+
+    char bytes[MAX_LENGTH * 2] = { 0 };
+    for (size_t i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = (char)(i * 31);
+    }
+
+    printf("%-10s %-16s %-16s\n", "blobs", "pointers", "inline");
+    for (size_t count = 1 << 16; count <= max_count; count <<= 2) {
+        const double pointer = pointers(count, bytes);
+        const double inline_blob = blobs(count, bytes);
+        printf("%-10zu %-16.4f %-16.4f\n", count, pointer, inline_blob);
+    }
+    printf("(checksum %llu)\n", (unsigned long long)checksum);
+
+    return 0;
+}
\ No newline at end of file
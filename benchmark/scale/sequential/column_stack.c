@@ -0,0 +1,113 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/stack/scstack.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SCAN_COUNT (1 << 4)
+
+typedef struct sample {
+    uint64_t timestamp;
+    double value;
+    char source[48];
+} sample_s;
+
+static const column_s schema[] = {
+    { .offset = offsetof(sample_s, timestamp), .size = sizeof(uint64_t), },
+    { .offset = offsetof(sample_s, value), .size = sizeof(double), },
+    { .offset = offsetof(sample_s, source), .size = sizeof(((sample_s*)0)->source), },
+};
+
+static uint64_t checksum = 0; // sum of scanned timestamps, keeps scans from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static void sum_samples(void * elements, const size_t n, const size_t size, void * args) {
+    (void)(size);
+    sample_s const * samples = elements;
+    uint64_t * sum = args;
+    for (size_t i = 0; i < n; ++i) {
+        (*sum) += samples[i].timestamp;
+    }
+}
+
+static void sum_timestamps(void * elements, const size_t n, const size_t size, void * args) {
+    (void)(size);
+    uint64_t const * timestamps = elements;
+    uint64_t * sum = args;
+    for (size_t i = 0; i < n; ++i) {
+        (*sum) += timestamps[i];
+    }
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Pushes whole samples into a stack and scans their timestamps as a single block of samples.
+static double rows(const size_t count, double * push) {
+    sstack_s stack = sstk_create();
+    sample_s sample = { 0 };
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        sample.timestamp = i;
+        sstk_push(&stack, &sample, sizeof(sample_s));
+    }
+    (*push) = seconds() - start;
+
+    start = seconds();
+    for (size_t i = 0; i < SCAN_COUNT; ++i) {
+        sstk_map(&stack, sum_samples, sizeof(sample_s), &checksum);
+    }
+    const double elapsed = seconds() - start;
+
+    sstk_destroy(&stack, destroy, sizeof(sample_s));
+    return elapsed;
+}
+
+/// @brief Pushes samples into a column stack and scans only its timestamp column as a single block.
+static double columns(const size_t count, double * push) {
+    scstack_s stack = scst_create(schema, sizeof(schema) / sizeof(column_s));
+    sample_s sample = { 0 };
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        sample.timestamp = i;
+        scst_push(&stack, &sample);
+    }
+    (*push) = seconds() - start;
+
+    start = seconds();
+    for (size_t i = 0; i < SCAN_COUNT; ++i) {
+        scst_map_column(&stack, 0, sum_timestamps, &checksum);
+    }
+    const double elapsed = seconds() - start;
+
+    scst_destroy(&stack, destroy);
+    return elapsed;
+}
+
+/// Compares scanning one field of 64 byte samples kept whole in a stack with scanning it as a column.
+/// Usage: scale_sequential_column_stack_benchmark [max sample count]
+int main(const int argc, char **argv) {
+    const size_t max_count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 22);
+
+    printf("%-10s %-16s %-16s %-16s %-16s\n", "samples", "row push", "row scan", "column push", "column scan");
+    for (size_t count = 1 << 16; count <= max_count; count <<= 2) {
+        double row_push = 0.0, column_push = 0.0;
+        const double row_scan = rows(count, &row_push);
+        const double column_scan = columns(count, &column_push);
+        printf("%-10zu %-16.4f %-16.4f %-16.4f %-16.4f\n", count, row_push, row_scan, column_push, column_scan);
+    }
+    printf("(checksum %llu)\n", (unsigned long long)checksum);
+
+    return 0;
+}
\ No newline at end of file
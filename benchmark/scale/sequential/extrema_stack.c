@@ -0,0 +1,109 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/stack/sestack.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE int
+
+static long long checksum = 0; // sum of minimums, keeps queries from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare(const void * a, const void * b) {
+    const DATA_TYPE * convert_a = a;
+    const DATA_TYPE * convert_b = b;
+
+    return ((*convert_a) > (*convert_b)) - ((*convert_a) < (*convert_b));
+}
+
+static bool minimum(void * element, const size_t size, void * args) {
+    (void)(size);
+    DATA_TYPE * convert = element, * current = args;
+    (*current) = (*convert) < (*current) ? (*convert) : (*current);
+    return true;
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Pushes or pops by operation sign and finds minimum after each operation by scanning with 'sstk_foreach'.
+static double scan(DATA_TYPE const * operations, const size_t count) {
+    sstack_s stack = sstk_create();
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        if (operations[i] >= 0 || sstk_is_empty(stack)) {
+            sstk_push(&stack, &operations[i], sizeof(DATA_TYPE));
+        } else {
+            sstk_pop(&stack, &element, sizeof(DATA_TYPE));
+        }
+
+        if (!sstk_is_empty(stack)) {
+            DATA_TYPE current = RAND_MAX;
+            sstk_foreach(&stack, minimum, sizeof(DATA_TYPE), &current);
+            checksum += current;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    sstk_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// @brief Pushes or pops by operation sign and reads tracked minimum after each operation.
+static double track(DATA_TYPE const * operations, const size_t count) {
+    sestack_s stack = sest_create(compare);
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        if (operations[i] >= 0 || sest_is_empty(stack)) {
+            sest_push(&stack, &operations[i], sizeof(DATA_TYPE));
+        } else {
+            sest_pop(&stack, &element, sizeof(DATA_TYPE));
+        }
+
+        if (!sest_is_empty(stack)) {
+            DATA_TYPE current = 0;
+            sest_minimum(stack, &current, sizeof(DATA_TYPE));
+            checksum += current;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    sest_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// Compares finding a stack's minimum after every push or pop by scanning it with reading a tracked minimum.
+/// Operations push and pop at random, slightly biased to pushes so that stack depth keeps growing.
+/// Usage: scale_sequential_extrema_stack_benchmark [max operation count]
+int main(const int argc, char **argv) {
+    const size_t max_count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 16);
+
+    DATA_TYPE * operations = malloc(max_count * sizeof(DATA_TYPE));
+    srand(42);
+    for (size_t i = 0; i < max_count; ++i) {
+        operations[i] = (rand() % 16) < 9 ? rand() : -1; // nine pushes for every seven pops
+    }
+
+    printf("%-12s %-16s %-16s\n", "operations", "scan seconds", "track seconds");
+    for (size_t count = 1 << 10; count <= max_count; count <<= 2) {
+        const double scan_time = scan(operations, count);
+        const double track_time = track(operations, count);
+        printf("%-12zu %-16.4f %-16.4f\n", count, scan_time, track_time);
+    }
+    printf("(checksum %lld)\n", checksum);
+
+    free(operations);
+    return 0;
+}
\ No newline at end of file
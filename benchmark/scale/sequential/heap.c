@@ -0,0 +1,103 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/heap/sheap.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE int
+
+static long long checksum = 0; // sum of popped elements, keeps pops from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare(const void * a, const void * b) {
+    const DATA_TYPE * convert_a = a;
+    const DATA_TYPE * convert_b = b;
+
+    return ((*convert_a) > (*convert_b)) - ((*convert_a) < (*convert_b));
+}
+
+static int compare_reverse(const void * a, const void * b) {
+    return compare(b, a);
+}
+
+static void manage(void * elements, const size_t n, const size_t size, void * args) {
+    (void)(args);
+    qsort(elements, n, size, compare_reverse); // smallest element ends on top of stack
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Pushes batches into a stack, sorts it with 'sstk_map' after each batch and pops smallest elements.
+static double sort_on_map(DATA_TYPE const * batches, const size_t rounds, const size_t batch, const size_t pops) {
+    sstack_s stack = sstk_create();
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < batch; ++i) {
+            sstk_push(&stack, &batches[(round * batch) + i], sizeof(DATA_TYPE));
+        }
+        sstk_map(&stack, manage, sizeof(DATA_TYPE), NULL);
+        for (size_t i = 0; i < pops && !sstk_is_empty(stack); ++i) {
+            sstk_pop(&stack, &element, sizeof(DATA_TYPE));
+            checksum += element;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    sstk_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// @brief Pushes batches into a heap with 'shep_push_n' and pops smallest elements.
+static double heap(DATA_TYPE const * batches, const size_t rounds, const size_t batch, const size_t pops, const size_t arity) {
+    sheap_s heap = shep_create(arity, compare);
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t round = 0; round < rounds; ++round) {
+        shep_push_n(&heap, &batches[round * batch], batch, sizeof(DATA_TYPE));
+        for (size_t i = 0; i < pops && !shep_is_empty(heap); ++i) {
+            shep_pop(&heap, &element, sizeof(DATA_TYPE));
+            checksum += element;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    shep_destroy(&heap, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// Compares d-ary heaps of arity 2, 4 and 8 with sorting a stack on map after each pushed batch.
+/// Each round pushes a batch of random integers and pops half as many smallest ones, so the queue keeps growing.
+/// Usage: scale_sequential_heap_benchmark [round count] [batch size]
+int main(const int argc, char **argv) {
+    const size_t rounds = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 8);
+    const size_t batch = argc > 2 ? strtoul(argv[2], NULL, 10) : (1 << 10);
+    const size_t pops = batch / 2;
+
+    DATA_TYPE * batches = malloc(rounds * batch * sizeof(DATA_TYPE));
+    srand(42);
+    for (size_t i = 0; i < rounds * batch; ++i) {
+        batches[i] = rand();
+    }
+
+    printf("%-16s %-12s\n", "queue", "seconds");
+    printf("%-16s %-12.4f\n", "sort on map", sort_on_map(batches, rounds, batch, pops));
+    for (size_t arity = 2; arity <= 8; arity <<= 1) {
+        printf("heap arity %-5zu %-12.4f\n", arity, heap(batches, rounds, batch, pops, arity));
+    }
+    printf("(checksum %lld)\n", checksum);
+
+    free(batches);
+    return 0;
+}
\ No newline at end of file
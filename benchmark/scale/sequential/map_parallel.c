@@ -0,0 +1,89 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/stack/sstack.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DATA_TYPE int
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare(const void * a, const void * b) {
+    const DATA_TYPE * convert_a = a;
+    const DATA_TYPE * convert_b = b;
+
+    return ((*convert_a) > (*convert_b)) - ((*convert_a) < (*convert_b));
+}
+
+static void manage(void * elements, const size_t n, const size_t size, void * args) {
+    (void)(args);
+    qsort(elements, n, size, compare);
+}
+
+static void merge(void * elements, const size_t left_n, const size_t right_n, const size_t size, void * args) {
+    (void)(args);
+    DATA_TYPE * temporary = malloc((left_n + right_n) * size);
+
+    DATA_TYPE * left = elements, * right = (DATA_TYPE*)elements + left_n;
+    DATA_TYPE * const left_end = right, * const right_end = right + right_n;
+    size_t i = 0;
+    while (left < left_end && right < right_end) {
+        temporary[i++] = (*right) < (*left) ? *(right++) : *(left++);
+    }
+    while (left < left_end) {
+        temporary[i++] = *(left++);
+    }
+    while (right < right_end) {
+        temporary[i++] = *(right++);
+    }
+
+    memcpy(elements, temporary, (left_n + right_n) * size);
+    free(temporary);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// Sorts a stack of random integers with 'sstk_map_parallel' for each thread count from 1 to N.
+/// Usage: scale_sequential_map_parallel_benchmark [element count] [maximum thread count]
+int main(const int argc, char **argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 22);
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 8;
+
+    sstack_s stack = sstk_create();
+    srand(42);
+    for (size_t i = 0; i < count; ++i) {
+        const DATA_TYPE element = rand();
+        sstk_push(&stack, &element, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE * original = malloc(count * sizeof(DATA_TYPE));
+    memcpy(original, stack.elements, count * sizeof(DATA_TYPE));
+
+    double single = 0.0;
+    printf("%-8s %-12s %-8s\n", "threads", "seconds", "speedup");
+    for (size_t threads = 1; threads <= max_threads; ++threads) {
+        memcpy(stack.elements, original, count * sizeof(DATA_TYPE));
+
+        const double start = seconds();
+        sstk_map_parallel(&stack, manage, merge, threads, sizeof(DATA_TYPE), NULL);
+        const double elapsed = seconds() - start;
+
+        if (threads == 1) {
+            single = elapsed;
+        }
+        printf("%-8zu %-12.4f %-8.2f\n", threads, elapsed, single / elapsed);
+    }
+
+    free(original);
+    sstk_destroy(&stack, destroy, sizeof(DATA_TYPE));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/deque/smdeque.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DATA_TYPE int
+
+static long long checksum = 0; // sum of rolling maximums, keeps queries from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare_reverse(const void * a, const void * b) {
+    const DATA_TYPE * convert_a = a;
+    const DATA_TYPE * convert_b = b;
+
+    return ((*convert_b) > (*convert_a)) - ((*convert_b) < (*convert_a));
+}
+
+static bool maximum(void * element, const size_t size, void * args) {
+    (void)(size);
+    DATA_TYPE * convert = element, * max = args;
+    if ((*convert) > (*max)) {
+        (*max) = (*convert);
+    }
+
+    return true;
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Keeps last 'window' samples in a deque and scans it with 'sdeq_foreach' on every tick.
+static double scan(DATA_TYPE const * samples, const size_t count, const size_t window) {
+    sdeque_s deque = sdeq_create();
+    DATA_TYPE element = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        if (deque.size == window) {
+            sdeq_dequeue_front(&deque, &element, sizeof(DATA_TYPE));
+        }
+        sdeq_enqueue_rear(&deque, &samples[i], sizeof(DATA_TYPE));
+
+        DATA_TYPE max = samples[i];
+        sdeq_foreach(&deque, maximum, sizeof(DATA_TYPE), &max);
+        checksum += max;
+    }
+    const double elapsed = seconds() - start;
+
+    sdeq_destroy(&deque, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// @brief Keeps rolling maximum candidates in a monotonic deque and peeks it on every tick.
+static double monotonic(DATA_TYPE const * samples, const size_t count, const size_t window) {
+    smdeque_s deque = smdq_create(window, compare_reverse, sizeof(DATA_TYPE));
+    DATA_TYPE max = 0;
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        smdq_push(&deque, &samples[i], sizeof(DATA_TYPE));
+        smdq_peek(deque, &max, sizeof(DATA_TYPE));
+        checksum += max;
+    }
+    const double elapsed = seconds() - start;
+
+    smdq_destroy(&deque, destroy, sizeof(DATA_TYPE));
+    return elapsed;
+}
+
+/// Compares rolling maximum over a sliding window computed by scanning a deque and by a monotonic deque.
+/// Usage: scale_sequential_monotonic_deque_benchmark [sample count] [maximum window]
+int main(const int argc, char **argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 20);
+    const size_t max_window = argc > 2 ? strtoul(argv[2], NULL, 10) : (1 << 10);
+
+    DATA_TYPE * samples = malloc(count * sizeof(DATA_TYPE));
+    srand(42);
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = rand();
+    }
+
+    printf("%-8s %-16s %-16s\n", "window", "scan seconds", "monotonic seconds");
+    for (size_t window = 4; window <= max_window; window <<= 2) {
+        const double scan_time = scan(samples, count, window);
+        const double monotonic_time = monotonic(samples, count, window);
+        printf("%-8zu %-16.4f %-16.4f\n", window, scan_time, monotonic_time);
+    }
+    printf("(checksum %lld)\n", checksum);
+
+    free(samples);
+    return 0;
+}
\ No newline at end of file
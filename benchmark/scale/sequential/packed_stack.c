@@ -0,0 +1,102 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/stack/sstack.h>
+#include <scale/sequential/stack/spstack.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SCAN_COUNT (1 << 4)
+
+static uint64_t checksum = 0; // sum of counted and popped flags, keeps scans and pops from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static bool count_flag(void * element, const size_t size, void * args) {
+    (void)(size);
+    uint64_t * count = args;
+    (*count) += *(unsigned char*)(element);
+    return true;
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Pushes flags as single bytes, counts set ones with a callback per flag and pops them all.
+static double bytes(const size_t count, double * scan) {
+    sstack_s stack = sstk_create();
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char flag = (unsigned char)((i * 7) % 3 == 0);
+        sstk_push(&stack, &flag, sizeof(unsigned char));
+    }
+    const double push = seconds() - start;
+
+    start = seconds();
+    for (size_t i = 0; i < SCAN_COUNT; ++i) {
+        sstk_foreach(&stack, count_flag, sizeof(unsigned char), &checksum);
+    }
+    (*scan) = seconds() - start;
+
+    start = seconds();
+    while (!sstk_is_empty(stack)) {
+        unsigned char flag = 0;
+        sstk_pop(&stack, &flag, sizeof(unsigned char));
+        checksum += flag;
+    }
+    const double pop = seconds() - start;
+
+    sstk_destroy(&stack, destroy, sizeof(unsigned char));
+    return push + pop;
+}
+
+/// @brief Pushes flags as single bits, counts set ones a word at a time and pops them all.
+static double bits(const size_t count, double * scan) {
+    spstack_s stack = spst_create(1);
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        spst_push(&stack, (i * 7) % 3 == 0);
+    }
+    const double push = seconds() - start;
+
+    start = seconds();
+    for (size_t i = 0; i < SCAN_COUNT; ++i) {
+        checksum += spst_count(&stack, 1);
+    }
+    (*scan) = seconds() - start;
+
+    start = seconds();
+    while (!spst_is_empty(stack)) {
+        checksum += spst_pop(&stack);
+    }
+    const double pop = seconds() - start;
+
+    spst_destroy(&stack);
+    return push + pop;
+}
+
+/// Compares a stack of flags kept as single bytes with a stack of flags packed into 64-bit words.
+/// Usage: scale_sequential_packed_stack_benchmark [max flag count]
+int main(const int argc, char **argv) {
+    const size_t max_count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 24);
+
+    printf("%-10s %-16s %-16s %-16s %-16s\n", "flags", "byte push/pop", "byte count", "bit push/pop", "bit count");
+    for (size_t count = 1 << 16; count <= max_count; count <<= 2) {
+        double byte_scan = 0.0, bit_scan = 0.0;
+        const double byte_stack = bytes(count, &byte_scan);
+        const double bit_stack = bits(count, &bit_scan);
+        printf("%-10zu %-16.4f %-16.4f %-16.4f %-16.4f\n", count, byte_stack, byte_scan, bit_stack, bit_scan);
+    }
+    printf("(checksum %llu)\n", (unsigned long long)checksum);
+
+    return 0;
+}
\ No newline at end of file
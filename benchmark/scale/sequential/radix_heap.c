@@ -0,0 +1,142 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/heap/sradix.h>
+#include <scale/sequential/heap/sheap.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct label {
+    uint64_t distance;
+    size_t node;
+} label_s;
+
+static uint64_t checksum = 0; // sum of shortest distances, keeps searches from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare(const void * a, const void * b) {
+    const label_s * convert_a = a;
+    const label_s * convert_b = b;
+
+    return (convert_a->distance > convert_b->distance) - (convert_a->distance < convert_b->distance);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Gets up to four grid neighbours of node.
+static size_t neighbours(const size_t node, const size_t width, size_t * adjacent) {
+    const size_t row = node / width, column = node % width;
+    size_t count = 0;
+
+    if (row) { adjacent[count++] = node - width; }
+    if (row + 1 < width) { adjacent[count++] = node + width; }
+    if (column) { adjacent[count++] = node - 1; }
+    if (column + 1 < width) { adjacent[count++] = node + 1; }
+
+    return count;
+}
+
+/// @brief Runs Dijkstra from top left node of grid with a d-ary heap, pushing duplicate labels instead of decreasing keys.
+static double heap(uint8_t const * weights, const size_t width, uint64_t * distances, const size_t arity) {
+    const size_t count = width * width;
+    for (size_t i = 0; i < count; ++i) {
+        distances[i] = UINT64_MAX;
+    }
+
+    sheap_s heap = shep_create(arity, compare);
+    label_s label = { .distance = 0, .node = 0, };
+    size_t adjacent[4] = { 0 };
+
+    const double start = seconds();
+    distances[0] = 0;
+    shep_push(&heap, &label, sizeof(label_s));
+    while (!shep_is_empty(heap)) {
+        shep_pop(&heap, &label, sizeof(label_s));
+        if (label.distance > distances[label.node]) { // stale duplicate
+            continue;
+        }
+
+        for (size_t i = 0, n = neighbours(label.node, width, adjacent); i < n; ++i) {
+            const uint64_t distance = label.distance + weights[adjacent[i]];
+            if (distance < distances[adjacent[i]]) {
+                distances[adjacent[i]] = distance;
+                const label_s next = { .distance = distance, .node = adjacent[i], };
+                shep_push(&heap, &next, sizeof(label_s));
+            }
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    checksum += distances[count - 1];
+    shep_destroy(&heap, destroy, sizeof(label_s));
+    return elapsed;
+}
+
+/// @brief Runs Dijkstra from top left node of grid with a radix heap, pushing duplicate nodes instead of decreasing keys.
+static double radix(uint8_t const * weights, const size_t width, uint64_t * distances) {
+    const size_t count = width * width;
+    for (size_t i = 0; i < count; ++i) {
+        distances[i] = UINT64_MAX;
+    }
+
+    sradix_s heap = srdx_create(sizeof(size_t));
+    size_t node = 0, adjacent[4] = { 0 };
+
+    const double start = seconds();
+    distances[0] = 0;
+    srdx_push(&heap, 0, &node, sizeof(size_t));
+    while (!srdx_is_empty(heap)) {
+        const uint64_t key = srdx_pop(&heap, &node, sizeof(size_t));
+        if (key > distances[node]) { // stale duplicate
+            continue;
+        }
+
+        for (size_t i = 0, n = neighbours(node, width, adjacent); i < n; ++i) {
+            const uint64_t distance = key + weights[adjacent[i]];
+            if (distance < distances[adjacent[i]]) {
+                distances[adjacent[i]] = distance;
+                srdx_push(&heap, distance, &adjacent[i], sizeof(size_t));
+            }
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    checksum += distances[count - 1];
+    srdx_destroy(&heap, destroy, sizeof(size_t));
+    return elapsed;
+}
+
+/// Compares d-ary heaps of arity 2 and 4 with a radix heap as Dijkstra's queue on square grids with small random weights.
+/// Usage: scale_sequential_radix_heap_benchmark [max grid width] [max edge weight, at most 255]
+int main(const int argc, char **argv) {
+    const size_t max_width = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 11);
+    const size_t max_weight = argc > 2 ? strtoul(argv[2], NULL, 10) : 100;
+
+    uint8_t * weights = malloc(max_width * max_width * sizeof(uint8_t));
+    uint64_t * distances = malloc(max_width * max_width * sizeof(uint64_t));
+    srand(42);
+    for (size_t i = 0; i < max_width * max_width; ++i) {
+        weights[i] = (uint8_t)(((size_t)rand() % max_weight) + 1);
+    }
+
+    printf("%-10s %-16s %-16s %-16s\n", "nodes", "heap 2 seconds", "heap 4 seconds", "radix seconds");
+    for (size_t width = 1 << 8; width <= max_width; width <<= 1) {
+        const double binary_time = heap(weights, width, distances, 2);
+        const double quaternary_time = heap(weights, width, distances, 4);
+        const double radix_time = radix(weights, width, distances);
+        printf("%-10zu %-16.4f %-16.4f %-16.4f\n", width * width, binary_time, quaternary_time, radix_time);
+    }
+    printf("(checksum %llu)\n", (unsigned long long)checksum);
+
+    free(distances);
+    free(weights);
+    return 0;
+}
\ No newline at end of file
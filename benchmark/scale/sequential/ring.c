@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/deque/sring.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct event {
+    size_t sequence;
+    char payload[24];
+} event_s;
+
+static size_t checksum = 0; // sum of snapshot sequences, keeps snapshots from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Keeps last 'capacity' events in a deque by dequeuing the oldest after every push past capacity.
+static double deque(const size_t count, const size_t capacity, const size_t snapshot_every, event_s * snapshot) {
+    sdeque_s deque = sdeq_create();
+    event_s event = { 0 }, oldest = { 0 };
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        event.sequence = i;
+        sdeq_enqueue_front(&deque, &event, sizeof(event_s));
+        if (deque.size > capacity) {
+            sdeq_dequeue_rear(&deque, &oldest, sizeof(event_s));
+        }
+
+        if (!((i + 1) % snapshot_every)) {
+            size_t j = 0;
+            for (sdeque_cursor_s cursor = sdeq_begin(&deque, sizeof(event_s)); !sdeq_end(cursor); sdeq_next(&cursor)) {
+                snapshot[j++] = *(event_s*)cursor.element;
+            }
+            checksum += snapshot[0].sequence;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    sdeq_destroy(&deque, destroy, sizeof(event_s));
+    return elapsed;
+}
+
+/// @brief Keeps last 'capacity' events in an overwrite ring.
+static double ring(const size_t count, const size_t capacity, const size_t snapshot_every, event_s * snapshot) {
+    sring_s ring = srng_create(capacity, sizeof(event_s));
+    event_s event = { 0 };
+
+    const double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        event.sequence = i;
+        srng_push(&ring, &event, sizeof(event_s));
+
+        if (!((i + 1) % snapshot_every)) {
+            srng_snapshot(ring, snapshot, sizeof(event_s));
+            checksum += snapshot[0].sequence;
+        }
+    }
+    const double elapsed = seconds() - start;
+
+    srng_destroy(&ring, destroy, sizeof(event_s));
+    return elapsed;
+}
+
+/// Compares keeping the last N events in a deque that dequeues past capacity with an overwrite ring,
+/// taking an ordered snapshot every so often for post-mortem dumps.
+/// Usage: scale_sequential_ring_benchmark [event count] [snapshot every]
+int main(const int argc, char **argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : (1 << 20);
+    const size_t snapshot_every = argc > 2 ? strtoul(argv[2], NULL, 10) : (1 << 12);
+
+    printf("%-10s %-16s %-16s\n", "capacity", "deque seconds", "ring seconds");
+    for (size_t capacity = 16; capacity <= (1 << 12); capacity <<= 4) {
+        event_s * snapshot = malloc(capacity * sizeof(event_s));
+        const double deque_time = deque(count, capacity, snapshot_every, snapshot);
+        const double ring_time = ring(count, capacity, snapshot_every, snapshot);
+        printf("%-10zu %-16.4f %-16.4f\n", capacity, deque_time, ring_time);
+        free(snapshot);
+    }
+    printf("(checksum %zu)\n", checksum);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <scale/sequential/queue/swheel.h>
+#include <scale/sequential/heap/sheap.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BATCH (1 << 8)
+
+typedef struct deadline {
+    uint64_t tick;
+    size_t id;
+} deadline_s;
+
+static size_t checksum = 0; // sum of expired timer ids, keeps expiry from being optimized away
+
+static void destroy(void * element) {
+    (void)(element);
+}
+
+static int compare(const void * a, const void * b) {
+    const deadline_s * convert_a = a;
+    const deadline_s * convert_b = b;
+
+    return (convert_a->tick > convert_b->tick) - (convert_a->tick < convert_b->tick);
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/// @brief Inserts timers into a wheel, cancels every fourth one by handle and advances until every timer expired.
+static void wheel(uint32_t const * delays, const size_t count, double * insert, double * cancel, double * expire) {
+    swheel_s wheel = swhl_create();
+    uint64_t * handles = malloc(count * sizeof(uint64_t));
+    size_t batch[BATCH] = { 0 }, id = 0;
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        handles[i] = swhl_insert(&wheel, delays[i], &i, sizeof(size_t));
+    }
+    (*insert) = seconds() - start;
+
+    start = seconds();
+    for (size_t i = 0; i < count; i += 4) {
+        swhl_cancel(&wheel, handles[i], &id, sizeof(size_t));
+    }
+    (*cancel) = seconds() - start;
+
+    start = seconds();
+    while (!swhl_is_empty(wheel)) {
+        swhl_advance(&wheel, 1);
+        for (size_t n = 0; (n = swhl_expire(&wheel, batch, BATCH, sizeof(size_t)));) {
+            for (size_t i = 0; i < n; ++i) {
+                checksum += batch[i];
+            }
+        }
+    }
+    (*expire) = seconds() - start;
+
+    swhl_destroy(&wheel, destroy, sizeof(size_t));
+    free(handles);
+}
+
+/// @brief Pushes deadlines into a binary heap, cancels every fourth one by marking it and pops due deadlines each tick.
+static void heap(uint32_t const * delays, const size_t count, double * insert, double * cancel, double * expire) {
+    sheap_s heap = shep_create(2, compare);
+    bool * cancelled = calloc(count, sizeof(bool));
+    deadline_s deadline = { 0 };
+
+    double start = seconds();
+    for (size_t i = 0; i < count; ++i) {
+        deadline = (deadline_s) { .tick = delays[i], .id = i, };
+        shep_push(&heap, &deadline, sizeof(deadline_s));
+    }
+    (*insert) = seconds() - start;
+
+    // heap can't remove arbitrary element, so cancelled deadlines are skipped once popped
+    start = seconds();
+    for (size_t i = 0; i < count; i += 4) {
+        cancelled[i] = true;
+    }
+    (*cancel) = seconds() - start;
+
+    start = seconds();
+    for (uint64_t now = 1; !shep_is_empty(heap); ++now) {
+        while (!shep_is_empty(heap)) {
+            shep_peek(heap, &deadline, sizeof(deadline_s));
+            if (deadline.tick > now) {
+                break;
+            }
+            shep_pop(&heap, &deadline, sizeof(deadline_s));
+            checksum += cancelled[deadline.id] ? 0 : deadline.id;
+        }
+    }
+    (*expire) = seconds() - start;
+
+    shep_destroy(&heap, destroy, sizeof(deadline_s));
+    free(cancelled);
+}
+
+/// Compares a hierarchical timing wheel with a binary heap of deadlines at 1M and 10M timers.
+/// Every timer gets a random delay of at least one tick, every fourth one is cancelled and the rest expire tick by tick.
+/// Usage: scale_sequential_timer_wheel_benchmark [max timer count] [delay span in ticks]
+int main(const int argc, char **argv) {
+    const size_t max_count = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+    const size_t span = argc > 2 ? strtoul(argv[2], NULL, 10) : (1 << 20);
+
+    uint32_t * delays = malloc(max_count * sizeof(uint32_t));
+    srand(42);
+    for (size_t i = 0; i < max_count; ++i) {
+        delays[i] = (uint32_t)(((size_t)rand() % span) + 1);
+    }
+
+    printf("%-10s %-6s %-14s %-14s %-14s %-14s\n", "timers", "queue", "insert s", "cancel s", "expire s", "Mtimers/s");
+    for (size_t count = 1000000; count <= max_count; count *= 10) {
+        double insert = 0.0, cancel = 0.0, expire = 0.0;
+
+        wheel(delays, count, &insert, &cancel, &expire);
+        printf("%-10zu %-6s %-14.4f %-14.4f %-14.4f %-14.2f\n", count, "wheel", insert, cancel, expire, (double)count / (insert + cancel + expire) / 1e6);
+
+        heap(delays, count, &insert, &cancel, &expire);
+        printf("%-10zu %-6s %-14.4f %-14.4f %-14.4f %-14.2f\n", count, "heap", insert, cancel, expire, (double)count / (insert + cancel + expire) / 1e6);
+    }
+    printf("(checksum %zu)\n", checksum);
+
+    free(delays);
+    return 0;
+}
\ No newline at end of file
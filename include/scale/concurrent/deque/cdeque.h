@@ -0,0 +1,75 @@
+#ifndef CDEQUE_H
+#define CDEQUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef CACHE_LINE_CDEQ
+#   define CACHE_LINE_CDEQ 64 // size of a single cache line in bytes used to separate owner and thief data
+#endif
+
+struct cdeque_array; // circular array of elements, retired arrays are kept until deque is destroyed
+
+typedef struct cdeque {
+    ptrdiff_t rear; // index of rear element, advanced by thieves
+    char rear_padding[CACHE_LINE_CDEQ];
+
+    ptrdiff_t front; // index after front element, moved only by owner
+    struct cdeque_array * array; // current circular array, replaced only by owner
+    char front_padding[CACHE_LINE_CDEQ];
+} cdeque_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates empty work-stealing deque.
+/// @param element_size Size of a single element.
+/// @return Empty deque structure.
+/// @note Deque must not be moved or copied once threads start using it.
+cdeque_s cdeq_create(const size_t element_size);
+
+/// @brief Destroys a deque. Must not be called while other threads are using it.
+/// @param deque Deque data structure.
+/// @param destroy Function pointer to destroy a single element in deque.
+/// @param element_size Size of a single element.
+void cdeq_destroy(cdeque_s * deque, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if deque is empty. Result may be stale by the time it is returned.
+/// @param deque Deque data structure.
+/// @return 'true' if deque is empty, 'false' otherwise.
+bool cdeq_is_empty(cdeque_s const * deque);
+
+/// @brief Enqueues element to the front of the deque, growing it if needed. Must only be called by owner thread.
+/// @param deque Deque data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void cdeq_enqueue_front(cdeque_s * deque, const void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the deque. Must only be called by owner thread.
+/// @param deque Deque data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if deque is empty or its last element was stolen.
+bool cdeq_dequeue_front(cdeque_s * deque, void * element, const size_t element_size);
+
+/// @brief Steals element from the rear of the deque. Can be called by any thread.
+/// @param deque Deque data structure.
+/// @param element Single element to save stolen element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was stolen, 'false' if deque is empty or another thread took the element first.
+bool cdeq_dequeue_rear(cdeque_s * deque, void * element, const size_t element_size);
+
+#endif // CDEQUE_H
\ No newline at end of file
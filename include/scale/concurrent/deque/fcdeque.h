@@ -0,0 +1,72 @@
+#ifndef FCDEQUE_H
+#define FCDEQUE_H
+
+#include <scale/sequential/deque/sdeque.h>
+
+#ifndef CACHE_LINE_FCDEQ
+#   define CACHE_LINE_FCDEQ 64 // size of a single cache line in bytes used to separate contended data
+#endif
+
+struct fcdeque_request; // publication slot where a thread leaves its operation for the combiner
+
+typedef struct fcdeque {
+    sdeque_s deque; // underlying sequential deque, touched only by the combiner
+    struct fcdeque_request * requests; // publication slots
+    char deque_padding[CACHE_LINE_FCDEQ];
+
+    size_t lock; // combiner lock, thread holding it applies every published request
+    char lock_padding[CACHE_LINE_FCDEQ];
+} fcdeque_s;
+
+/// @brief Creates empty flat-combining deque.
+/// @return Empty deque structure.
+/// @note Deque must not be moved or copied once threads start using it.
+fcdeque_s fcdeq_create(void);
+
+/// @brief Destroys a deque. Must not be called while other threads are using it.
+/// @param deque Deque data structure.
+/// @param destroy Function pointer to destroy a single element in deque.
+/// @param element_size Size of a single element.
+void fcdeq_destroy(fcdeque_s * deque, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Enqueues element to the front of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void fcdeq_enqueue_front(fcdeque_s * deque, const void * element, const size_t element_size);
+
+/// @brief Enqueues element to the rear of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void fcdeq_enqueue_rear(fcdeque_s * deque, const void * element, const size_t element_size);
+
+/// @brief Peeks the front of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was peeked, 'false' if deque is empty.
+bool fcdeq_peek_front(fcdeque_s * deque, void * element, const size_t element_size);
+
+/// @brief Peeks the rear of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was peeked, 'false' if deque is empty.
+bool fcdeq_peek_rear(fcdeque_s * deque, void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if deque is empty.
+bool fcdeq_dequeue_front(fcdeque_s * deque, void * element, const size_t element_size);
+
+/// @brief Dequeues element from the rear of the deque.
+/// @param deque Deque data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if deque is empty.
+bool fcdeq_dequeue_rear(fcdeque_s * deque, void * element, const size_t element_size);
+
+#endif // FCDEQUE_H
\ No newline at end of file
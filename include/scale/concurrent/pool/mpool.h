@@ -0,0 +1,55 @@
+#ifndef MPOOL_H
+#define MPOOL_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#include <pthread.h>
+
+typedef struct mpool {
+    sstack_s depot; // stack of full magazines shared by every thread, touched only while holding mutex
+    pthread_mutex_t * mutex; // guards depot, allocated since a copied mutex is undefined
+    size_t magazine_size; // number of elements that fill a single magazine
+} mpool_s;
+
+typedef struct mpool_cache {
+    sstack_s loaded, previous; // magazines owned by a single thread, elements are taken from and put into loaded one
+} mpool_cache_s;
+
+/// @brief Creates empty magazine pool.
+/// @param magazine_size Number of elements that fill a single magazine.
+/// @return Empty pool structure.
+/// @note Pool must not be moved or copied once threads start using it.
+mpool_s mpool_create(const size_t magazine_size);
+
+/// @brief Destroys a pool and every element in its depot. Thread caches must be destroyed before.
+/// @param pool Pool data structure.
+/// @param destroy Function pointer to destroy a single element in pool.
+/// @param element_size Size of a single element.
+void mpool_destroy(mpool_s * pool, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Creates empty thread cache. Each thread using the pool needs its own cache.
+/// @return Empty cache structure.
+mpool_cache_s mpool_cache_create(void);
+
+/// @brief Destroys a thread cache by returning its elements to pool's depot.
+/// @param pool Pool data structure.
+/// @param cache Thread cache of calling thread.
+/// @param element_size Size of a single element.
+void mpool_cache_destroy(mpool_s * pool, mpool_cache_s * cache, const size_t element_size);
+
+/// @brief Gets element from calling thread's cache, refilling it with a full magazine from depot if it is empty.
+/// @param pool Pool data structure.
+/// @param cache Thread cache of calling thread.
+/// @param element Single element to save gotten element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was gotten, 'false' if cache and depot are empty.
+bool mpool_get(mpool_s * pool, mpool_cache_s * cache, void * element, const size_t element_size);
+
+/// @brief Puts element into calling thread's cache, moving a full magazine to depot if cache is full.
+/// @param pool Pool data structure.
+/// @param cache Thread cache of calling thread.
+/// @param element Single element to put.
+/// @param element_size Size of a single element.
+void mpool_put(mpool_s * pool, mpool_cache_s * cache, const void * element, const size_t element_size);
+
+#endif // MPOOL_H
\ No newline at end of file
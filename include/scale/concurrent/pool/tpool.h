@@ -0,0 +1,58 @@
+#ifndef TPOOL_H
+#define TPOOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+struct tpool_runtime; // shared state of workers, kept behind a pointer so pool structure can be copied freely
+
+typedef struct tpool {
+    struct tpool_runtime * runtime; // workers, their work-stealing deques and injection queue
+    size_t worker_count; // number of worker threads that were started
+} tpool_s;
+
+typedef struct tpool_group {
+    size_t pending; // number of spawned tasks in group that have not finished yet
+} tpool_group_s;
+
+/// @brief Function pointer to run a single task.
+typedef void (*task_fn) (void * argument);
+/// @brief Function pointer to run a chunk of iterations in range [begin, end).
+typedef void (*range_fn) (size_t begin, size_t end, void * argument);
+
+/// @brief Creates work-stealing thread pool and starts its workers.
+/// @param worker_count Number of worker threads.
+/// @return Pool structure.
+/// @note If a thread can't be created, pool runs with workers started before it, and waiting threads run tasks too.
+tpool_s tpool_create(const size_t worker_count);
+
+/// @brief Stops and joins workers, then destroys pool. Every spawned group must be waited on before.
+/// @param pool Pool data structure.
+void tpool_destroy(tpool_s * pool);
+
+/// @brief Creates empty task group.
+/// @return Group structure with no pending tasks.
+tpool_group_s tpool_group_create(void);
+
+/// @brief Spawns task into group. Worker threads push it on their own deque, other threads into injection queue.
+/// @param pool Pool data structure.
+/// @param group Group to count task in, must stay valid until group is waited on.
+/// @param task Function pointer to task.
+/// @param argument Argument passed to task, must stay valid until task finishes.
+void tpool_spawn(tpool_s pool, tpool_group_s * group, const task_fn task, void * argument);
+
+/// @brief Waits until every task in group finishes, running pending tasks on calling thread meanwhile.
+/// @param pool Pool data structure.
+/// @param group Group to wait on.
+void tpool_wait(tpool_s pool, tpool_group_s * group);
+
+/// @brief Runs 'body' over range [begin, end) split into chunks of 'grain' iterations, and waits for it to finish.
+/// @param pool Pool data structure.
+/// @param begin First iteration.
+/// @param end Iteration after last one.
+/// @param grain Maximum number of iterations in a single chunk.
+/// @param body Function pointer to run a chunk of iterations.
+/// @param argument Argument passed to every chunk.
+void tpool_parallel_for(tpool_s pool, const size_t begin, const size_t end, const size_t grain, const range_fn body, void * argument);
+
+#endif // TPOOL_H
\ No newline at end of file
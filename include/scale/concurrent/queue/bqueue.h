@@ -0,0 +1,72 @@
+#ifndef BQUEUE_H
+#define BQUEUE_H
+
+#include <scale/sequential/queue/squeue.h>
+
+#include <stdint.h>
+#include <pthread.h>
+
+#ifndef CACHE_LINE_BQUE
+#   define CACHE_LINE_BQUE 64 // size of a single cache line in bytes used to separate contended data
+#endif
+
+#define WAIT_FOREVER_BQUE UINT64_MAX // timeout that makes waiting dequeues wait until an element arrives or queue closes
+
+typedef struct bqueue {
+    squeue_s queue; // underlying sequential queue, touched only while holding mutex
+    pthread_mutex_t * mutex; // guards queue and closed flag, allocated since a copied mutex is undefined
+    bool closed; // 'true' once queue stops accepting elements
+    char queue_padding[CACHE_LINE_BQUE];
+
+    uint32_t sequence; // futex word, changed by producers only when a consumer is parked on it
+    uint32_t waiters; // number of consumers parked or about to park on sequence
+    char futex_padding[CACHE_LINE_BQUE];
+} bqueue_s;
+
+/// @brief Creates empty unbounded blocking queue.
+/// @return Empty queue structure.
+/// @note Queue must not be moved or copied once threads start using it.
+bqueue_s bque_create(void);
+
+/// @brief Destroys a queue. Must not be called while other threads are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void bque_destroy(bqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Closes queue, so that enqueues fail and dequeues stop waiting once remaining elements are drained.
+/// @param queue Queue data structure.
+void bque_close(bqueue_s * queue);
+
+/// @brief Enqueues element to the back of the queue and wakes a parked consumer if there is one.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was enqueued, 'false' if queue is closed.
+bool bque_enqueue(bqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the queue without waiting.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if queue is empty.
+bool bque_try_dequeue(bqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the queue, waiting for one to arrive if queue is empty.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param timeout Maximum number of nanoseconds to wait, or 'WAIT_FOREVER_BQUE'.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if timeout passed or queue is closed and drained.
+bool bque_dequeue_wait(bqueue_s * queue, void * element, const uint64_t timeout, const size_t element_size);
+
+/// @brief Dequeues up to 'max' elements from the front of the queue, waiting for at least one if queue is empty.
+/// @param queue Queue data structure.
+/// @param elements Array of at least 'max' elements to save dequeued elements into.
+/// @param max Maximum number of elements to dequeue.
+/// @param timeout Maximum number of nanoseconds to wait, or 'WAIT_FOREVER_BQUE'.
+/// @param element_size Size of a single element.
+/// @return Number of dequeued elements, zero if timeout passed or queue is closed and drained.
+size_t bque_dequeue_batch_wait(bqueue_s * queue, void * elements, const size_t max, const uint64_t timeout, const size_t element_size);
+
+#endif // BQUEUE_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef EVQUEUE_H
+#define EVQUEUE_H
+
+#include <scale/sequential/queue/squeue.h>
+
+#include <pthread.h>
+
+typedef struct evqueue {
+    squeue_s queue; // underlying sequential queue, touched only while holding mutex
+    pthread_mutex_t * mutex; // guards queue and signaled flag, allocated since a copied mutex is undefined
+    int descriptor; // pollable descriptor that is readable while queue holds elements, '-1' if creation failed
+    int notifier; // descriptor written to signal queue, same as 'descriptor' when backed by an eventfd
+    bool is_signaled; // 'true' once a producer signaled since last drain, so only empty to non-empty transition signals
+} evqueue_s;
+
+/// @brief Creates empty unbounded queue whose descriptor can be watched by poll, select or epoll.
+/// @return Empty queue structure, with 'descriptor' set to '-1' if descriptor could not be created.
+/// @note Queue must not be moved or copied once threads start using it.
+evqueue_s evque_create(void);
+
+/// @brief Destroys a queue and closes its descriptor. Must not be called while other threads are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void evque_destroy(evqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if queue is empty.
+/// @param queue Queue data structure.
+/// @return 'true' if queue was empty at the moment of the check, 'false' otherwise.
+bool evque_is_empty(evqueue_s * queue);
+
+/// @brief Enqueues element to the back of the queue, signaling descriptor if queue was empty.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void evque_enqueue(evqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Enqueues array of elements to the back of the queue under a single lock and at most a single signal.
+/// @param queue Queue data structure.
+/// @param elements Array of elements to enqueue.
+/// @param n Number of elements to enqueue.
+/// @param element_size Size of a single element.
+void evque_enqueue_n(evqueue_s * queue, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Dequeues up to 'max' elements from the front of the queue without waiting, clearing descriptor once
+/// queue is drained. Descriptor stays readable if elements remain, so level-triggered polls call back again.
+/// @param queue Queue data structure.
+/// @param elements Array of at least 'max' elements to save dequeued elements into.
+/// @param max Maximum number of elements to dequeue.
+/// @param element_size Size of a single element.
+/// @return Number of dequeued elements.
+size_t evque_dequeue_batch(evqueue_s * queue, void * elements, const size_t max, const size_t element_size);
+
+#endif // EVQUEUE_H
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef FCQUEUE_H
+#define FCQUEUE_H
+
+#include <scale/sequential/queue/squeue.h>
+
+#ifndef CACHE_LINE_FCQUE
+#   define CACHE_LINE_FCQUE 64 // size of a single cache line in bytes used to separate contended data
+#endif
+
+struct fcqueue_request; // publication slot where a thread leaves its operation for the combiner
+
+typedef struct fcqueue {
+    squeue_s queue; // underlying sequential queue, touched only by the combiner
+    struct fcqueue_request * requests; // publication slots
+    char queue_padding[CACHE_LINE_FCQUE];
+
+    size_t lock; // combiner lock, thread holding it applies every published request
+    char lock_padding[CACHE_LINE_FCQUE];
+} fcqueue_s;
+
+/// @brief Creates empty flat-combining queue.
+/// @return Empty queue structure.
+/// @note Queue must not be moved or copied once threads start using it.
+fcqueue_s fcque_create(void);
+
+/// @brief Destroys a queue. Must not be called while other threads are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void fcque_destroy(fcqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Enqueues element to the back of the queue.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void fcque_enqueue(fcqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Peeks the front of the queue.
+/// @param queue Queue data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was peeked, 'false' if queue is empty.
+bool fcque_peek(fcqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the queue.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if queue is empty.
+bool fcque_dequeue(fcqueue_s * queue, void * element, const size_t element_size);
+
+#endif // FCQUEUE_H
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef CACHE_LINE_MPMC
+#   define CACHE_LINE_MPMC 64 // size of a single cache line in bytes used to separate producer and consumer data
+#endif
+
+typedef struct mpmcqueue {
+    char * slots; // array of slots, each a sequence number followed by an element
+    size_t capacity; // power of two number of slots, at least two
+    char shared_padding[CACHE_LINE_MPMC];
+
+    size_t tail; // next enqueue position claimed by producers
+    char producer_padding[CACHE_LINE_MPMC];
+
+    size_t head; // next dequeue position claimed by consumers
+    char consumer_padding[CACHE_LINE_MPMC];
+} mpmcqueue_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates empty bounded multi-producer/multi-consumer queue.
+/// @param capacity Maximum number of elements in queue, rounded up to the next power of two that is at least two.
+/// @param element_size Size of a single element.
+/// @return Empty queue structure.
+/// @note Queue must not be moved or copied once threads start using it.
+mpmcqueue_s mpmc_create(const size_t capacity, const size_t element_size);
+
+/// @brief Destroys a queue. Must not be called while other threads are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void mpmc_destroy(mpmcqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Tries to enqueue element to the back of the queue without blocking.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was enqueued, 'false' if queue is full.
+bool mpmc_try_enqueue(mpmcqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Tries to dequeue element from the start of the queue without blocking.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if queue is empty.
+bool mpmc_try_dequeue(mpmcqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Enqueues element to the back of the queue, spinning and then yielding while queue is full.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void mpmc_enqueue(mpmcqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Dequeues element from the start of the queue, spinning and then yielding while queue is empty.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+void mpmc_dequeue(mpmcqueue_s * queue, void * element, const size_t element_size);
+
+#endif // MPMCQUEUE_H
\ No newline at end of file
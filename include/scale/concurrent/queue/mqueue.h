@@ -0,0 +1,60 @@
+#ifndef MQUEUE_H
+#define MQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+struct mqueue_shard; // sequential queue of time-stamped elements guarded by a try-lock
+
+typedef struct mqueue {
+    struct mqueue_shard * shards; // array of shards
+    size_t shard_count; // number of shards
+} mqueue_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates empty relaxed FIFO multi-queue.
+/// @param shard_count Number of sharded queues, usually a small multiple of the number of threads.
+/// @param element_size Size of a single element.
+/// @return Empty queue structure.
+mqueue_s mque_create(const size_t shard_count, const size_t element_size);
+
+/// @brief Destroys a queue. Must not be called while other threads are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void mque_destroy(mqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if queue is empty. Result may be stale by the time it is returned.
+/// @param queue Queue data structure.
+/// @return 'true' if every shard is empty, 'false' otherwise.
+bool mque_is_empty(mqueue_s const * queue);
+
+/// @brief Enqueues time-stamped element to the back of a random unlocked shard.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void mque_enqueue(mqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Dequeues the older front element of two random shards, so elements leave in approximately FIFO order.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if every shard is empty.
+bool mque_dequeue(mqueue_s * queue, void * element, const size_t element_size);
+
+#endif // MQUEUE_H
\ No newline at end of file
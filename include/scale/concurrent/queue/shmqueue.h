@@ -0,0 +1,109 @@
+#ifndef SHMQUEUE_H
+#define SHMQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef CACHE_LINE_SHMQ
+#   define CACHE_LINE_SHMQ 64 // size of a single cache line in bytes used to separate producer and consumer data
+#endif
+
+struct shmqueue_header; // fixed header at the start of shared segment, followed by ring of elements
+
+typedef struct shmqueue {
+    struct shmqueue_header * header; // mapped segment or NULL if queue isn't attached
+    char * elements; // ring of elements in mapped segment
+    size_t capacity; // power of two capacity of ring, copied from header when attached
+    size_t mapped_size; // size of mapped segment in bytes
+    uint64_t generation; // generation of segment when attached, changes when segment is reinitialized
+    uint64_t cached_head, cached_tail; // this process's last seen copies of consumer's head and producer's tail
+} shmqueue_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates or reinitializes named shared-memory single-producer/single-consumer queue and attaches to it.
+/// @param name Name of shared-memory object, starting with '/'.
+/// @param capacity Maximum number of elements in queue, rounded up to the next power of two.
+/// @param element_size Size of a single element.
+/// @return Empty attached queue structure, or queue with NULL header if segment couldn't be created or if an existing
+/// segment has another size.
+/// @note Reinitializing drops elements left by a crashed process and makes other attached handles invalid. An existing
+/// segment is never resized, it must be unlinked first to change its capacity or element size.
+shmqueue_s shmq_create(const char * name, const size_t capacity, const size_t element_size);
+
+/// @brief Attaches to named queue initialized by another process.
+/// @param name Name of shared-memory object, starting with '/'.
+/// @param element_size Size of a single element, must match the one queue was created with.
+/// @return Attached queue structure, or queue with NULL header if segment doesn't exist or isn't initialized.
+shmqueue_s shmq_attach(const char * name, const size_t element_size);
+
+/// @brief Detaches from queue, leaving segment and its elements for other processes.
+/// @param queue Queue data structure.
+void shmq_detach(shmqueue_s * queue);
+
+/// @brief Removes name of shared-memory object, segment is freed once every process detaches.
+/// @param name Name of shared-memory object, starting with '/'.
+/// @return 'true' if name was removed, 'false' otherwise.
+bool shmq_unlink(const char * name);
+
+/// @brief Checks if attached segment is still the one queue was attached to and wasn't reinitialized since.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is valid, 'false' if it has to be attached again.
+bool shmq_is_valid(shmqueue_s const * queue);
+
+/// @brief Checks if queue is full. Result may be stale if called from the consumer process.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is full, 'false' otherwise.
+bool shmq_is_full(shmqueue_s const * queue);
+
+/// @brief Checks if queue is empty. Result may be stale if called from the producer process.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is empty, 'false' otherwise.
+bool shmq_is_empty(shmqueue_s const * queue);
+
+/// @brief Enqueues element to the back of the queue. Must only be called by the producer.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was enqueued, 'false' if queue is full or segment was reinitialized since attaching.
+bool shmq_enqueue(shmqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Dequeues element from the start of the queue. Must only be called by the consumer.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if queue is empty or segment was reinitialized since attaching.
+bool shmq_dequeue(shmqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Enqueues as many elements from array as fit into the queue. Must only be called by the producer.
+/// @param queue Queue data structure.
+/// @param elements Array of elements to enqueue.
+/// @param n Number of elements in array.
+/// @param element_size Size of a single element.
+/// @return Number of enqueued elements, zero if segment was reinitialized since attaching.
+size_t shmq_enqueue_n(shmqueue_s * queue, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Dequeues up to 'n' elements into array. Must only be called by the consumer.
+/// @param queue Queue data structure.
+/// @param elements Array to save dequeued elements into.
+/// @param n Maximum number of elements to dequeue.
+/// @param element_size Size of a single element.
+/// @return Number of dequeued elements, zero if segment was reinitialized since attaching.
+size_t shmq_dequeue_n(shmqueue_s * queue, void * elements, const size_t n, const size_t element_size);
+
+#endif // SHMQUEUE_H
\ No newline at end of file
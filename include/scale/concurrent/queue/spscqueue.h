@@ -0,0 +1,92 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef CACHE_LINE_SPSC
+#   define CACHE_LINE_SPSC 64 // size of a single cache line in bytes used to separate producer and consumer data
+#endif
+
+typedef struct spscqueue {
+    void * elements; // array of elements
+    size_t capacity; // power of two capacity of elements array
+    char shared_padding[CACHE_LINE_SPSC];
+
+    size_t tail, cached_head; // producer's enqueue index and its last seen copy of consumer's head index
+    char producer_padding[CACHE_LINE_SPSC];
+
+    size_t head, cached_tail; // consumer's dequeue index and its last seen copy of producer's tail index
+    char consumer_padding[CACHE_LINE_SPSC];
+} spscqueue_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates empty bounded single-producer/single-consumer queue.
+/// @param capacity Maximum number of elements in queue, rounded up to the next power of two.
+/// @param element_size Size of a single element.
+/// @return Empty queue structure.
+/// @note Queue must not be moved or copied once producer and consumer threads start using it.
+spscqueue_s spsc_create(const size_t capacity, const size_t element_size);
+
+/// @brief Destroys a queue. Must not be called while producer or consumer are using it.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+void spsc_destroy(spscqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if queue is full. Result may be stale if called from the consumer thread.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is full, 'false' otherwise.
+bool spsc_is_full(spscqueue_s const * queue);
+
+/// @brief Checks if queue is empty. Result may be stale if called from the producer thread.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is empty, 'false' otherwise.
+bool spsc_is_empty(spscqueue_s const * queue);
+
+/// @brief Enqueues element to the back of the queue. Must only be called by the producer thread.
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was enqueued, 'false' if queue is full.
+bool spsc_enqueue(spscqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Dequeues element from the start of the queue. Must only be called by the consumer thread.
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was dequeued, 'false' if queue is empty.
+bool spsc_dequeue(spscqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Enqueues as many elements from array as fit into the queue. Must only be called by the producer thread.
+/// @param queue Queue data structure.
+/// @param elements Array of elements to enqueue.
+/// @param n Number of elements in array.
+/// @param element_size Size of a single element.
+/// @return Number of enqueued elements.
+size_t spsc_enqueue_n(spscqueue_s * queue, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Dequeues up to 'n' elements into array. Must only be called by the consumer thread.
+/// @param queue Queue data structure.
+/// @param elements Array to save dequeued elements into.
+/// @param n Maximum number of elements to dequeue.
+/// @param element_size Size of a single element.
+/// @return Number of dequeued elements.
+size_t spsc_dequeue_n(spscqueue_s * queue, void * elements, const size_t n, const size_t element_size);
+
+#endif // SPSCQUEUE_H
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef CSTACK_H
+#define CSTACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef CACHE_LINE_CSTK
+#   define CACHE_LINE_CSTK 64 // size of a single cache line in bytes used to separate contended data
+#endif
+
+typedef struct cstack {
+    char * nodes; // array of nodes, each a next node index followed by an element
+    char * exchanges; // elimination array, each slot an exchange state followed by an element
+    size_t capacity; // number of nodes
+    char shared_padding[CACHE_LINE_CSTK];
+
+    uint64_t top; // tagged index of top node, upper half is a change counter against ABA
+    char top_padding[CACHE_LINE_CSTK];
+
+    uint64_t free; // tagged index of first unused node
+    char free_padding[CACHE_LINE_CSTK];
+} cstack_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Creates empty bounded lock-free stack.
+/// @param capacity Maximum number of elements in stack.
+/// @param element_size Size of a single element.
+/// @return Empty stack structure.
+/// @note Stack must not be moved or copied once threads start using it.
+cstack_s cstk_create(const size_t capacity, const size_t element_size);
+
+/// @brief Destroys a stack. Must not be called while other threads are using it.
+/// @param stack Stack data structure.
+/// @param destroy Function pointer to destroy a single element in stack.
+/// @param element_size Size of a single element.
+void cstk_destroy(cstack_s * stack, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if stack is empty. Result may be stale by the time it is returned.
+/// @param stack Stack data structure.
+/// @return 'true' if stack is empty, 'false' otherwise.
+bool cstk_is_empty(cstack_s const * stack);
+
+/// @brief Pushes element to the top of the stack, or hands it directly to a concurrent pop under contention.
+/// @param stack Stack data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was pushed, 'false' if stack is full.
+bool cstk_push(cstack_s * stack, const void * element, const size_t element_size);
+
+/// @brief Peeps the top of the stack.
+/// @param stack Stack data structure.
+/// @param element Single element to save peeped element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was peeped, 'false' if stack is empty.
+bool cstk_peep(cstack_s const * stack, void * element, const size_t element_size);
+
+/// @brief Pops element from the top of the stack, or takes it directly from a concurrent push under contention.
+/// @param stack Stack data structure.
+/// @param element Single element to save poped element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was poped, 'false' if stack is empty.
+bool cstk_pop(cstack_s * stack, void * element, const size_t element_size);
+
+#endif // CSTACK_H
\ No newline at end of file
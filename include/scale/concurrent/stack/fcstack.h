@@ -0,0 +1,52 @@
+#ifndef FCSTACK_H
+#define FCSTACK_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#ifndef CACHE_LINE_FCSTK
+#   define CACHE_LINE_FCSTK 64 // size of a single cache line in bytes used to separate contended data
+#endif
+
+struct fcstack_request; // publication slot where a thread leaves its operation for the combiner
+
+typedef struct fcstack {
+    sstack_s stack; // underlying sequential stack, touched only by the combiner
+    struct fcstack_request * requests; // publication slots
+    char stack_padding[CACHE_LINE_FCSTK];
+
+    size_t lock; // combiner lock, thread holding it applies every published request
+    char lock_padding[CACHE_LINE_FCSTK];
+} fcstack_s;
+
+/// @brief Creates empty flat-combining stack.
+/// @return Empty stack structure.
+/// @note Stack must not be moved or copied once threads start using it.
+fcstack_s fcstk_create(void);
+
+/// @brief Destroys a stack. Must not be called while other threads are using it.
+/// @param stack Stack data structure.
+/// @param destroy Function pointer to destroy a single element in stack.
+/// @param element_size Size of a single element.
+void fcstk_destroy(fcstack_s * stack, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Pushes element to the top of the stack.
+/// @param stack Stack data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+void fcstk_push(fcstack_s * stack, const void * element, const size_t element_size);
+
+/// @brief Peeps the top of the stack.
+/// @param stack Stack data structure.
+/// @param element Single element to save peeped element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was peeped, 'false' if stack is empty.
+bool fcstk_peep(fcstack_s * stack, void * element, const size_t element_size);
+
+/// @brief Pops element from the top of the stack.
+/// @param stack Stack data structure.
+/// @param element Single element to save poped element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was poped, 'false' if stack is empty.
+bool fcstk_pop(fcstack_s * stack, void * element, const size_t element_size);
+
+#endif // FCSTACK_H
\ No newline at end of file
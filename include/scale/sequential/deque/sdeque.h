@@ -9,6 +9,17 @@ typedef struct sdeque {
     size_t size, current, capacity; // size, current index and capacity of deque
 } sdeque_s;
 
+typedef struct sdeque_cursor {
+    char * element; // pointer to current element
+    size_t left; // number of elements left to iterate in current segment, including current
+    char * wrap; // pointer to first element of the second segment
+    size_t wrap_left; // number of elements in the second segment
+    ptrdiff_t step; // signed distance in bytes to next element
+} sdeque_cursor_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
 /// @brief Function pointer to destroy a single element in data structure. Based on 'free';
 typedef void   (*destroy_fn) (void * element);
 /// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
@@ -17,6 +28,10 @@ typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
 typedef bool   (*operate_fn) (void * element, size_t size, void * args);
 /// @brief Function pointer to manage an array of finite number of element in data structure.
 typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
 
 /// @brief Creates empty deque.
 /// @return Empty deque structure.
@@ -81,6 +96,21 @@ void sdeq_dequeue_front(sdeque_s * deque, void * element, const size_t element_s
 /// @param element_size Size of a single element.
 void sdeq_dequeue_rear(sdeque_s * deque, void * element, const size_t element_size);
 
+/// @brief Gets pointer to element at index counted from the rear of the deque.
+/// @param deque Deque data structure.
+/// @param index Index of element, where '0' is the rear and 'size - 1' is the front of the deque.
+/// @param element_size Size of a single element.
+/// @return Pointer to element inside deque's elements array.
+/// @note Pointer is invalidated by any operation that changes the deque's size.
+void * sdeq_at(sdeque_s const * deque, const size_t index, const size_t element_size);
+
+/// @brief Sets element at index counted from the rear of the deque.
+/// @param deque Deque data structure.
+/// @param index Index of element, where '0' is the rear and 'size - 1' is the front of the deque.
+/// @param element Single element to copy into deque.
+/// @param element_size Size of a single element.
+void sdeq_set(sdeque_s * deque, const size_t index, const void * element, const size_t element_size);
+
 /// @brief Iterates over each element in deque.
 /// @param deque Deque data structure.
 /// @param operate Fucntion pointer to perform a single operation on element in deque using arguments.
@@ -93,6 +123,77 @@ void sdeq_foreach(sdeque_s const * deque, const operate_fn operate, const size_t
 /// @param manage Function pointer to manage an array of finite number of element in deque.
 /// @param element_size Size of a single element.
 /// @param arguments Generic arguments for function pointer.
-void sdeq_map(sdeque_s const * deque, const manage_fn manage, const size_t element_size, void * arguments);
+/// @note If elements wrap around the end of the deque's array, the array is rotated in place so that
+/// 'manage' gets deque's own storage without any temporary copy.
+void sdeq_map(sdeque_s * deque, const manage_fn manage, const size_t element_size, void * arguments);
+
+/// @brief Splits deque's elements into chunks and manages each chunk on a separate thread.
+/// @param deque Deque data structure.
+/// @param manage Function pointer to manage a single chunk of elements in deque.
+/// @param merge Function pointer to merge two adjacent managed chunks, or NULL to leave chunks as they are.
+/// @param thread_count Maximum number of threads, including calling thread, to manage chunks with.
+/// @param element_size Size of a single element.
+/// @param arguments Generic arguments for function pointers.
+/// @note Chunks are merged pairwise in rounds, with merges of the same round running in parallel.
+void sdeq_map_parallel(sdeque_s * deque, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments);
+
+/// @brief Creates cursor at the rear of the deque that iterates towards the front.
+/// @param deque Deque data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the rear element, or ended cursor if deque is empty.
+/// @note Cursor is invalidated by any operation that changes the deque's size.
+static inline sdeque_cursor_s sdeq_begin(sdeque_s const * deque, const size_t element_size) {
+    // split ring into right segment from current index until capacity and left segment from array's start
+    const size_t right_size = (deque->current + deque->size) > deque->capacity ? deque->capacity - deque->current : deque->size;
+
+    return (sdeque_cursor_s) {
+        .element = (char*)(deque->elements) + (deque->current * element_size), .left = right_size,
+        .wrap = deque->elements, .wrap_left = deque->size - right_size, .step = (ptrdiff_t)element_size,
+    };
+}
+
+/// @brief Creates cursor at the front of the deque that iterates towards the rear.
+/// @param deque Deque data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the front element, or ended cursor if deque is empty.
+/// @note Cursor is invalidated by any operation that changes the deque's size.
+static inline sdeque_cursor_s sdeq_rbegin(sdeque_s const * deque, const size_t element_size) {
+    if (!deque->size) {
+        return (sdeque_cursor_s) { .element = deque->elements, .wrap = deque->elements, };
+    }
+
+    const size_t right_size = (deque->current + deque->size) > deque->capacity ? deque->capacity - deque->current : deque->size;
+    const size_t left_size = deque->size - right_size;
+
+    char * right_end = (char*)(deque->elements) + ((deque->current + right_size - 1) * element_size);
+    if (!left_size) { // deque doesn't wrap, so only right segment is iterated
+        return (sdeque_cursor_s) { .element = right_end, .left = right_size, .wrap = right_end, .step = -(ptrdiff_t)element_size, };
+    }
+
+    return (sdeque_cursor_s) {
+        .element = (char*)(deque->elements) + ((left_size - 1) * element_size), .left = left_size,
+        .wrap = right_end, .wrap_left = right_size, .step = -(ptrdiff_t)element_size,
+    };
+}
+
+/// @brief Checks if cursor went past the last element.
+/// @param cursor Deque cursor.
+/// @return 'true' if there are no more elements to iterate, 'false' otherwise.
+static inline bool sdeq_end(const sdeque_cursor_s cursor) {
+    return !(cursor.left);
+}
+
+/// @brief Moves cursor to the next element, jumping to the second segment once the first is exhausted.
+/// @param cursor Deque cursor that has not ended.
+static inline void sdeq_next(sdeque_cursor_s * cursor) {
+    if (--cursor->left) {
+        cursor->element += cursor->step;
+        return;
+    }
+
+    cursor->element = cursor->wrap;
+    cursor->left = cursor->wrap_left;
+    cursor->wrap_left = 0;
+}
 
 #endif // SDEQUE_H
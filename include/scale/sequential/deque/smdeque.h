@@ -0,0 +1,62 @@
+#ifndef SMDEQUE_H
+#define SMDEQUE_H
+
+#include <scale/sequential/deque/sdeque.h>
+
+#ifndef COMPARE_FUNCTION_TYPEDEF
+#define COMPARE_FUNCTION_TYPEDEF // guards comparator typedef shared by ordered data structure headers from redefinition
+
+/// @brief Function pointer to compare two elements in data structure. Based on 'qsort' comparators.
+typedef int (*compare_fn) (const void * a, const void * b);
+
+#endif // COMPARE_FUNCTION_TYPEDEF
+
+typedef struct smdeque {
+    sdeque_s elements; // candidate elements, sorted from front to rear by comparator
+    sdeque_s positions; // push position of each candidate, increasing from front to rear
+    void * scratch; // single element that dominated candidates are dequeued into
+    compare_fn compare; // comparator that puts smallest element of window at the front
+    size_t window; // number of most recent pushes that candidates are kept for
+    size_t pushed; // total number of pushed elements, position of next pushed element
+} smdeque_s;
+
+/// @brief Creates empty monotonic deque that tracks smallest element among most recent pushes.
+/// @param window Number of most recent pushed elements that make up sliding window.
+/// @param compare Comparator, use a reversed one to track largest element instead.
+/// @param element_size Size of a single element.
+/// @return Empty monotonic deque structure.
+smdeque_s smdq_create(const size_t window, const compare_fn compare, const size_t element_size);
+
+/// @brief Destroys a monotonic deque.
+/// @param deque Monotonic deque data structure.
+/// @param destroy Function pointer to destroy a single candidate element in deque.
+/// @param element_size Size of a single element.
+void smdq_destroy(smdeque_s * deque, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if window is empty.
+/// @param deque Monotonic deque data structure.
+/// @return 'true' if no element was pushed yet, 'false' otherwise.
+bool smdq_is_empty(const smdeque_s deque);
+
+/// @brief Pushes element into window in amortized O(1), evicting candidates that slid out of window and
+/// dropping those that can never again be smallest.
+/// @param deque Monotonic deque data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+/// @note Evicted and dropped candidates are discarded without 'destroy', so elements must not own resources.
+void smdq_push(smdeque_s * deque, const void * element, const size_t element_size);
+
+/// @brief Pushes array of elements into window, skipping those that slide out of window before array ends.
+/// @param deque Monotonic deque data structure.
+/// @param elements Array of elements to push.
+/// @param n Number of elements to push.
+/// @param element_size Size of a single element.
+void smdq_push_n(smdeque_s * deque, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Peeks smallest element in window in O(1).
+/// @param deque Monotonic deque data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+void smdq_peek(const smdeque_s deque, void * element, const size_t element_size);
+
+#endif // SMDEQUE_H
\ No newline at end of file
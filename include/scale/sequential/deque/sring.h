@@ -0,0 +1,64 @@
+#ifndef SRING_H
+#define SRING_H
+
+#include <scale/sequential/deque/sdeque.h>
+
+typedef struct sring {
+    sdeque_s deque; // fixed-capacity deque with oldest element at rear and newest at front, never reallocated
+} sring_s;
+
+/// @brief Creates empty ring that overwrites its oldest element once full. Allocates its only array.
+/// @param capacity Maximum number of elements kept in ring.
+/// @param element_size Size of a single element.
+/// @return Empty ring structure.
+/// @note Ring's deque can be read with 'sdeq_at', 'sdeq_peek_front' and cursors, but must not be resized with them.
+sring_s srng_create(const size_t capacity, const size_t element_size);
+
+/// @brief Destroys a ring.
+/// @param ring Ring data structure.
+/// @param destroy Function pointer to destroy a single element in ring.
+/// @param element_size Size of a single element.
+void srng_destroy(sring_s * ring, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if ring is full, so that next push overwrites its oldest element.
+/// @param ring Ring data structure.
+/// @return 'true' if ring is full, 'false' otherwise.
+bool srng_is_full(const sring_s ring);
+
+/// @brief Checks if ring is empty.
+/// @param ring Ring data structure.
+/// @return 'true' if ring is empty, 'false' otherwise.
+bool srng_is_empty(const sring_s ring);
+
+/// @brief Pushes element as the newest one, overwriting the oldest element if ring is full.
+/// @param ring Ring data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+/// @return 'true' if oldest element was overwritten, 'false' otherwise.
+/// @note Overwritten elements are discarded without 'destroy', so elements must not own resources.
+bool srng_push(sring_s * ring, const void * element, const size_t element_size);
+
+/// @brief Pushes array of elements with at most two copies, only the last capacity's worth if array is larger.
+/// @param ring Ring data structure.
+/// @param elements Array of elements to push, from oldest to newest.
+/// @param n Number of elements to push.
+/// @param element_size Size of a single element.
+/// @return Number of older elements that were overwritten or skipped.
+size_t srng_push_n(sring_s * ring, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Copies up to 'k' most recent elements from oldest to newest with at most two copies.
+/// @param ring Ring data structure.
+/// @param elements Array of at least 'k' elements to copy into.
+/// @param k Maximum number of recent elements to copy.
+/// @param element_size Size of a single element.
+/// @return Number of copied elements.
+size_t srng_peek_recent(const sring_s ring, void * elements, const size_t k, const size_t element_size);
+
+/// @brief Copies every element in ring from oldest to newest with at most two copies.
+/// @param ring Ring data structure.
+/// @param elements Array of at least capacity elements to copy into.
+/// @param element_size Size of a single element.
+/// @return Number of copied elements.
+size_t srng_snapshot(const sring_s ring, void * elements, const size_t element_size);
+
+#endif // SRING_H
\ No newline at end of file
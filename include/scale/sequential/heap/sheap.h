@@ -0,0 +1,76 @@
+#ifndef SHEAP_H
+#define SHEAP_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#ifndef COMPARE_FUNCTION_TYPEDEF
+#define COMPARE_FUNCTION_TYPEDEF // guards comparator typedef shared by ordered data structure headers from redefinition
+
+/// @brief Function pointer to compare two elements in data structure. Based on 'qsort' comparators.
+typedef int (*compare_fn) (const void * a, const void * b);
+
+#endif // COMPARE_FUNCTION_TYPEDEF
+
+typedef struct sheap {
+    sstack_s stack; // growable array of elements laid out as implicit d-ary tree
+    compare_fn compare; // comparator that puts smallest element at the top
+    size_t arity; // number of children per node
+} sheap_s;
+
+/// @brief Creates empty d-ary heap priority queue.
+/// @param arity Number of children per node, at least 2. Arities of 4 or 8 keep a node's children in one or two
+/// cache lines for small elements and shorten tree, which pays off at large sizes.
+/// @param compare Comparator, elements are popped from smallest to largest.
+/// @return Empty heap structure.
+sheap_s shep_create(const size_t arity, const compare_fn compare);
+
+/// @brief Destroys a heap.
+/// @param heap Heap data structure.
+/// @param destroy Function pointer to destroy a single element in heap.
+/// @param element_size Size of a single element.
+void shep_destroy(sheap_s * heap, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Creates a copy of heap and its elements.
+/// @param heap Heap data structure.
+/// @param copy Function pointer to copy a single element in heap.
+/// @param element_size Size of a single element.
+/// @return A copy of the heap.
+sheap_s shep_copy(const sheap_s heap, const copy_fn copy, const size_t element_size);
+
+/// @brief Checks if heap size will overflow.
+/// @param heap Heap data structure.
+/// @return 'true' if heap size will overflow, 'false' otherwise.
+bool shep_is_full(const sheap_s heap);
+
+/// @brief Checks if heap is empty.
+/// @param heap Heap data structure.
+/// @return 'true' if heap is empty, 'false' otherwise.
+bool shep_is_empty(const sheap_s heap);
+
+/// @brief Pushes element into heap.
+/// @param heap Heap data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+void shep_push(sheap_s * heap, const void * element, const size_t element_size);
+
+/// @brief Pushes array of elements into heap, rebuilding whole heap bottom-up in linear time if array is at
+/// least as large as heap, or sifting each element up otherwise.
+/// @param heap Heap data structure.
+/// @param elements Array of elements to push.
+/// @param n Number of elements to push.
+/// @param element_size Size of a single element.
+void shep_push_n(sheap_s * heap, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Peeks the smallest element of the heap.
+/// @param heap Heap data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+void shep_peek(const sheap_s heap, void * element, const size_t element_size);
+
+/// @brief Pops the smallest element of the heap.
+/// @param heap Heap data structure.
+/// @param element Single element to save popped element into.
+/// @param element_size Size of a single element.
+void shep_pop(sheap_s * heap, void * element, const size_t element_size);
+
+#endif // SHEAP_H
\ No newline at end of file
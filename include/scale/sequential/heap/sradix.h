@@ -0,0 +1,54 @@
+#ifndef SRADIX_H
+#define SRADIX_H
+
+#include <stdint.h>
+
+#include <scale/sequential/stack/sstack.h>
+
+typedef struct sradix {
+    sstack_s * buckets; // stacks of entries with key followed by element, bucketed by highest bit differing from last key
+    char * scratch; // single entry to build and pop entries in, allocated with buckets
+    uint64_t last; // last popped or peeked key, no key in heap is smaller
+    size_t size; // number of elements in heap
+} sradix_s;
+
+/// @brief Creates empty radix heap for monotone integer keys.
+/// @param element_size Size of a single element.
+/// @return Empty heap structure.
+sradix_s srdx_create(const size_t element_size);
+
+/// @brief Destroys a heap.
+/// @param heap Heap data structure.
+/// @param destroy Function pointer to destroy a single element in heap.
+/// @param element_size Size of a single element.
+void srdx_destroy(sradix_s * heap, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if heap is empty.
+/// @param heap Heap data structure.
+/// @return 'true' if heap is empty, 'false' otherwise.
+bool srdx_is_empty(const sradix_s heap);
+
+/// @brief Pushes element with key in constant time.
+/// @param heap Heap data structure.
+/// @param key Element's priority, not smaller than last popped or peeked key.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+void srdx_push(sradix_s * heap, const uint64_t key, const void * element, const size_t element_size);
+
+/// @brief Copies element with smallest key without popping it.
+/// @param heap Heap data structure.
+/// @param element Element buffer to copy smallest element into.
+/// @param element_size Size of a single element.
+/// @return Smallest key in heap.
+/// @note Moves smallest key's bucket down like pop does, so heap is taken by pointer.
+uint64_t srdx_peek(sradix_s * heap, void * element, const size_t element_size);
+
+/// @brief Pops element with smallest key, which becomes lower bound of any later pushed key.
+/// @param heap Heap data structure.
+/// @param element Element buffer to copy popped element into.
+/// @param element_size Size of a single element.
+/// @return Popped element's key.
+/// @note Each element moves to a lower bucket at most once per key bit, so pop is amortized constant per bit.
+uint64_t srdx_pop(sradix_s * heap, void * element, const size_t element_size);
+
+#endif // SRADIX_H
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef SAQUEUE_H
+#define SAQUEUE_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#ifndef COMBINE_FUNCTION_TYPEDEF
+#define COMBINE_FUNCTION_TYPEDEF // guards combine typedef shared by aggregating data structure headers from redefinition
+
+/// @brief Function pointer to combine right element into left one in place, so that 'left = left (+) right'.
+/// Operation must be associative, but doesn't need to be commutative or have an identity.
+typedef void (*combine_fn) (void * left, const void * right);
+
+#endif // COMBINE_FUNCTION_TYPEDEF
+
+typedef struct saqueue {
+    sstack_s front; // stack of entries with element followed by aggregate of it and every newer entry below it
+    sstack_s back; // stack of enqueued elements not yet moved to front
+    char * back_aggregate; // aggregate of back's elements, valid if back isn't empty
+    char * scratch; // single front entry to build entries in, allocated with back aggregate
+    combine_fn combine; // associative combine function
+} saqueue_s;
+
+/// @brief Creates empty sliding-window aggregation queue.
+/// @param combine Associative combine function, aggregate combines elements from oldest to newest.
+/// @param element_size Size of a single element.
+/// @return Empty queue structure.
+saqueue_s saqu_create(const combine_fn combine, const size_t element_size);
+
+/// @brief Destroys a queue.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single element in queue.
+/// @param element_size Size of a single element.
+/// @note Aggregates are discarded without 'destroy', so combined values must not own resources.
+void saqu_destroy(saqueue_s * queue, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if queue is empty.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is empty, 'false' otherwise.
+bool saqu_is_empty(const saqueue_s queue);
+
+/// @brief Enqueues element to the back of the queue in O(1).
+/// @param queue Queue data structure.
+/// @param element Single element to enqueue.
+/// @param element_size Size of a single element.
+void saqu_enqueue(saqueue_s * queue, const void * element, const size_t element_size);
+
+/// @brief Peeks the front of the queue.
+/// @param queue Queue data structure.
+/// @param element Single element to save peeked element into.
+/// @param element_size Size of a single element.
+void saqu_peek(const saqueue_s queue, void * element, const size_t element_size);
+
+/// @brief Dequeues element from the front of the queue in amortized O(1).
+/// @param queue Queue data structure.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+void saqu_dequeue(saqueue_s * queue, void * element, const size_t element_size);
+
+/// @brief Combines every element in queue from oldest to newest in O(1).
+/// @param queue Queue data structure.
+/// @param aggregate Single element to save aggregate into.
+/// @param element_size Size of a single element.
+void saqu_aggregate(const saqueue_s queue, void * aggregate, const size_t element_size);
+
+#endif // SAQUEUE_H
\ No newline at end of file
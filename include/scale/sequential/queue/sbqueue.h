@@ -0,0 +1,69 @@
+#ifndef SBQUEUE_H
+#define SBQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+typedef struct sbqueue {
+    char * bytes; // buffer of records, each a blob's length followed by blob padded to length's alignment
+    size_t current, length, capacity; // offset of start record, offset after last record and allocated bytes in buffer
+    size_t size; // number of blobs in queue
+} sbqueue_s;
+
+/// @brief Creates empty queue of variable length blobs.
+/// @return Empty queue structure.
+sbqueue_s sbqu_create(void);
+
+/// @brief Destroys a queue.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single blob in queue.
+void sbqu_destroy(sbqueue_s * queue, const destroy_fn destroy);
+
+/// @brief Checks if queue is empty.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is empty, 'false' otherwise.
+bool sbqu_is_empty(const sbqueue_s queue);
+
+/// @brief Enqueues copy of blob inline to the back of the queue.
+/// @param queue Queue data structure.
+/// @param blob Bytes of blob to enqueue.
+/// @param length Number of bytes in blob, can be zero.
+void sbqu_enqueue(sbqueue_s * queue, const void * blob, const size_t length);
+
+/// @brief Peeks the start of the queue in place.
+/// @param queue Queue data structure.
+/// @param length Length of peeked blob to save into.
+/// @return Pointer to blob inside queue's buffer, aligned to 'size_t'.
+/// @note Pointer is invalidated by enqueue and destroy.
+void * sbqu_peek(const sbqueue_s queue, size_t * length);
+
+/// @brief Dequeues blob from the start of the queue in place.
+/// @param queue Queue data structure.
+/// @param length Length of dequeued blob to save into.
+/// @return Pointer to dequeued blob still inside queue's buffer, aligned to 'size_t'.
+/// @note Pointer is invalidated by enqueue and destroy. Dequeued bytes are reused once enqueue runs out of buffer.
+void * sbqu_dequeue(sbqueue_s * queue, size_t * length);
+
+/// @brief Iterates over each blob in queue from start to end.
+/// @param queue Queue data structure.
+/// @param operate Fucntion pointer to perform a single operation on blob and its length using arguments.
+/// @param arguments Generic arguments for function pointer.
+void sbqu_foreach(sbqueue_s const * queue, const operate_fn operate, void * arguments);
+
+#endif // SBQUEUE_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef SCQUEUE_H
+#define SCQUEUE_H
+
+#include <scale/sequential/queue/squeue.h>
+
+#ifndef COLUMN_SCHEMA_TYPEDEF
+#define COLUMN_SCHEMA_TYPEDEF // guards column typedef shared by column data structure headers from redefinition
+
+/// @brief Single column of record, i.e. field's offset in record and its size. Based on 'offsetof' and 'sizeof'.
+typedef struct column {
+    size_t offset, size;
+} column_s;
+
+#endif // COLUMN_SCHEMA_TYPEDEF
+
+typedef struct scqueue {
+    squeue_s * columns; // one queue per column, each with a contiguous array of that column's fields
+    column_s * schema; // copy of column schema, allocated with columns
+    char * scratch; // single record to gather records into when destroying, allocated with columns
+    size_t count; // number of columns
+} scqueue_s;
+
+/// @brief Creates empty struct-of-arrays queue described by column schema.
+/// @param schema Array of columns, i.e. offset and size of each of record's fields to keep.
+/// @param count Number of columns.
+/// @return Empty queue structure.
+scqueue_s scqu_create(column_s const * schema, const size_t count);
+
+/// @brief Destroys a queue.
+/// @param queue Queue data structure.
+/// @param destroy Function pointer to destroy a single record gathered from queue's columns.
+void scqu_destroy(scqueue_s * queue, const destroy_fn destroy);
+
+/// @brief Checks if queue is empty.
+/// @param queue Queue data structure.
+/// @return 'true' if queue is empty, 'false' otherwise.
+bool scqu_is_empty(const scqueue_s queue);
+
+/// @brief Enqueues record at the end of queue, scattering its fields into columns.
+/// @param queue Queue data structure.
+/// @param record Single record to enqueue.
+void scqu_enqueue(scqueue_s * queue, const void * record);
+
+/// @brief Gathers start record of queue from columns without dequeuing it.
+/// @param queue Queue data structure.
+/// @param record Record buffer to gather fields into, bytes outside of schema's columns are left as they are.
+void scqu_peek(const scqueue_s queue, void * record);
+
+/// @brief Dequeues start record of queue, gathering its fields from columns.
+/// @param queue Queue data structure.
+/// @param record Record buffer to gather fields into, bytes outside of schema's columns are left as they are.
+void scqu_dequeue(scqueue_s * queue, void * record);
+
+/// @brief Iterates over each field in a single column from start to end of queue.
+/// @param queue Queue data structure.
+/// @param column Index of column in schema.
+/// @param operate Function pointer to perform a single operation on field in column using arguments.
+/// @param arguments Generic arguments for function pointer.
+void scqu_foreach_column(scqueue_s const * queue, const size_t column, const operate_fn operate, void * arguments);
+
+/// @brief Maps a single column into its contiguous array of fields to manage, without touching other columns.
+/// @param queue Queue data structure.
+/// @param column Index of column in schema.
+/// @param manage Function pointer to manage an array of finite number of fields in column.
+/// @param arguments Generic arguments for function pointer.
+void scqu_map_column(scqueue_s const * queue, const size_t column, const manage_fn manage, void * arguments);
+
+#endif // SCQUEUE_H
\ No newline at end of file
@@ -9,6 +9,15 @@ typedef struct squeue {
     size_t size, current; // number of elements and index of start element in queue
 } squeue_s;
 
+typedef struct squeue_cursor {
+    char * element; // pointer to current element
+    size_t left; // number of elements left to iterate, including current
+    ptrdiff_t step; // signed distance in bytes to next element
+} squeue_cursor_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
 /// @brief Function pointer to destroy a single element in data structure. Based on 'free';
 typedef void   (*destroy_fn) (void * element);
 /// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
@@ -17,6 +26,10 @@ typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
 typedef bool   (*operate_fn) (void * element, size_t size, void * args);
 /// @brief Function pointer to manage an array of finite number of element in data structure.
 typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
 
 /// @brief Creates empty queue.
 /// @return Empty queue structure.
@@ -63,6 +76,21 @@ void sque_peek(const squeue_s queue, void * element, const size_t element_size);
 /// @param element_size Size of a single element.
 void sque_dequeue(squeue_s * queue, void * element, const size_t element_size);
 
+/// @brief Gets pointer to element at index counted from the start of the queue.
+/// @param queue Queue data structure.
+/// @param index Index of element, where '0' is the start of the queue.
+/// @param element_size Size of a single element.
+/// @return Pointer to element inside queue's elements array.
+/// @note Pointer is invalidated by any operation that changes the queue's size.
+void * sque_at(squeue_s const * queue, const size_t index, const size_t element_size);
+
+/// @brief Sets element at index counted from the start of the queue.
+/// @param queue Queue data structure.
+/// @param index Index of element, where '0' is the start of the queue.
+/// @param element Single element to copy into queue.
+/// @param element_size Size of a single element.
+void sque_set(squeue_s * queue, const size_t index, const void * element, const size_t element_size);
+
 /// @brief Iterates over each element in queue.
 /// @param queue Queue data structure.
 /// @param operate Fucntion pointer to perform a single operation on element in queue using arguments.
@@ -77,4 +105,49 @@ void sque_foreach(squeue_s const * queue, const operate_fn operate, const size_t
 /// @param arguments Generic arguments for function pointer.
 void sque_map(squeue_s const * queue, const manage_fn manage, const size_t element_size, void * arguments);
 
+/// @brief Splits queue's elements into chunks and manages each chunk on a separate thread.
+/// @param queue Queue data structure.
+/// @param manage Function pointer to manage a single chunk of elements in queue.
+/// @param merge Function pointer to merge two adjacent managed chunks, or NULL to leave chunks as they are.
+/// @param thread_count Maximum number of threads, including calling thread, to manage chunks with.
+/// @param element_size Size of a single element.
+/// @param arguments Generic arguments for function pointers.
+/// @note Chunks are merged pairwise in rounds, with merges of the same round running in parallel.
+void sque_map_parallel(squeue_s const * queue, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments);
+
+/// @brief Creates cursor at the start of the queue that iterates towards the end.
+/// @param queue Queue data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the start element, or ended cursor if queue is empty.
+/// @note Cursor is invalidated by any operation that changes the queue's size.
+static inline squeue_cursor_s sque_begin(squeue_s const * queue, const size_t element_size) {
+    char * start = (char*)(queue->elements) + (queue->current * element_size);
+    return (squeue_cursor_s) { .element = start, .left = queue->size, .step = (ptrdiff_t)element_size, };
+}
+
+/// @brief Creates cursor at the end of the queue that iterates towards the start.
+/// @param queue Queue data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the last enqueued element, or ended cursor if queue is empty.
+/// @note Cursor is invalidated by any operation that changes the queue's size.
+static inline squeue_cursor_s sque_rbegin(squeue_s const * queue, const size_t element_size) {
+    char * end = queue->size ? (char*)(queue->elements) + ((queue->current + queue->size - 1) * element_size) : queue->elements;
+    return (squeue_cursor_s) { .element = end, .left = queue->size, .step = -(ptrdiff_t)element_size, };
+}
+
+/// @brief Checks if cursor went past the last element.
+/// @param cursor Queue cursor.
+/// @return 'true' if there are no more elements to iterate, 'false' otherwise.
+static inline bool sque_end(const squeue_cursor_s cursor) {
+    return !(cursor.left);
+}
+
+/// @brief Moves cursor to the next element.
+/// @param cursor Queue cursor that has not ended.
+static inline void sque_next(squeue_cursor_s * cursor) {
+    if (--cursor->left) { // don't move pointer before array's start when reverse iteration ends
+        cursor->element += cursor->step;
+    }
+}
+
 #endif // SQUEUE_H
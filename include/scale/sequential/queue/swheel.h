@@ -0,0 +1,70 @@
+#ifndef SWHEEL_H
+#define SWHEEL_H
+
+#include <stdint.h>
+
+#include <scale/sequential/queue/squeue.h>
+#include <scale/sequential/stack/sstack.h>
+
+typedef struct swheel {
+    squeue_s * buckets; // levels of buckets with handles of timers, each level's slot spans all slots of level below
+    squeue_s expired; // handles of expired timers, of which first 'taken' were already taken
+    sstack_s timers; // record of every timer slot with deadline and generation, reused through 'vacant'
+    sstack_s elements; // element of every timer slot, parallel to timers
+    sstack_s vacant; // indexes of unused timer slots
+    uint64_t now; // current tick
+    size_t size, taken; // number of pending timers and number of taken handles at start of expired queue
+} swheel_s;
+
+/// @brief Creates empty hierarchical timing wheel at tick zero. Allocates its buckets array.
+/// @return Empty wheel structure.
+swheel_s swhl_create(void);
+
+/// @brief Destroys a wheel.
+/// @param wheel Wheel data structure.
+/// @param destroy Function pointer to destroy element of a single pending timer.
+/// @param element_size Size of a single element.
+void swhl_destroy(swheel_s * wheel, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if wheel has no pending timers.
+/// @param wheel Wheel data structure.
+/// @return 'true' if wheel is empty, 'false' otherwise.
+bool swhl_is_empty(const swheel_s wheel);
+
+/// @brief Checks if timer is pending, i.e. it wasn't cancelled and its element wasn't taken by 'swhl_expire'.
+/// @param wheel Wheel data structure.
+/// @param handle Handle of timer returned by 'swhl_insert'.
+/// @return 'true' if timer is pending, 'false' otherwise.
+bool swhl_is_pending(const swheel_s wheel, const uint64_t handle);
+
+/// @brief Inserts timer that expires 'delay' ticks after wheel's current tick in constant time.
+/// @param wheel Wheel data structure.
+/// @param delay Number of ticks until timer expires, zero expires it immediately.
+/// @param element Element to take once timer expires.
+/// @param element_size Size of a single element.
+/// @return Handle of timer, never zero.
+/// @note Delays past the last level's horizon are reinserted whenever their bucket is reached.
+uint64_t swhl_insert(swheel_s * wheel, const uint64_t delay, const void * element, const size_t element_size);
+
+/// @brief Cancels pending timer in constant time, its handle is left in its bucket and skipped once reached.
+/// @param wheel Wheel data structure.
+/// @param handle Handle of timer returned by 'swhl_insert'.
+/// @param element Element buffer to copy cancelled timer's element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if timer was pending and got cancelled, 'false' otherwise.
+bool swhl_cancel(swheel_s * wheel, const uint64_t handle, void * element, const size_t element_size);
+
+/// @brief Advances wheel by a number of ticks, cascading higher level buckets and moving due timers to expired ones.
+/// @param wheel Wheel data structure.
+/// @param ticks Number of ticks to advance.
+void swhl_advance(swheel_s * wheel, const uint64_t ticks);
+
+/// @brief Takes up to 'n' elements of expired timers, in order of expiry, and recycles their timer slots.
+/// @param wheel Wheel data structure.
+/// @param elements Array of at least 'n' elements to copy into.
+/// @param n Maximum number of elements to take.
+/// @param element_size Size of a single element.
+/// @return Number of taken elements.
+size_t swhl_expire(swheel_s * wheel, void * elements, const size_t n, const size_t element_size);
+
+#endif // SWHEEL_H
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef SBSTACK_H
+#define SBSTACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+typedef struct sbstack {
+    char * bytes; // buffer of records, each a blob's length, blob padded to length's alignment and its length again
+    size_t length, capacity; // number of used and allocated bytes in buffer
+    size_t size; // number of blobs in stack
+} sbstack_s;
+
+/// @brief Creates empty stack of variable length blobs.
+/// @return Empty stack structure.
+sbstack_s sbst_create(void);
+
+/// @brief Destroys a stack.
+/// @param stack Stack data structure.
+/// @param destroy Function pointer to destroy a single blob in stack.
+void sbst_destroy(sbstack_s * stack, const destroy_fn destroy);
+
+/// @brief Checks if stack is empty.
+/// @param stack Stack data structure.
+/// @return 'true' if stack is empty, 'false' otherwise.
+bool sbst_is_empty(const sbstack_s stack);
+
+/// @brief Pushes copy of blob inline to the top of the stack.
+/// @param stack Stack data structure.
+/// @param blob Bytes of blob to push.
+/// @param length Number of bytes in blob, can be zero.
+void sbst_push(sbstack_s * stack, const void * blob, const size_t length);
+
+/// @brief Peeps the top of the stack in place.
+/// @param stack Stack data structure.
+/// @param length Length of peeped blob to save into.
+/// @return Pointer to blob inside stack's buffer, aligned to 'size_t'.
+/// @note Pointer is invalidated by push and destroy.
+void * sbst_peep(const sbstack_s stack, size_t * length);
+
+/// @brief Pops blob from the top of the stack in place.
+/// @param stack Stack data structure.
+/// @param length Length of popped blob to save into.
+/// @return Pointer to popped blob still inside stack's buffer, aligned to 'size_t'.
+/// @note Pointer is invalidated by push and destroy. Buffer doesn't shrink on pop.
+void * sbst_pop(sbstack_s * stack, size_t * length);
+
+/// @brief Iterates over each blob in stack from bottom to top.
+/// @param stack Stack data structure.
+/// @param operate Fucntion pointer to perform a single operation on blob and its length using arguments.
+/// @param arguments Generic arguments for function pointer.
+void sbst_foreach(sbstack_s const * stack, const operate_fn operate, void * arguments);
+
+#endif // SBSTACK_H
\ No newline at end of file
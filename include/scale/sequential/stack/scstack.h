@@ -0,0 +1,68 @@
+#ifndef SCSTACK_H
+#define SCSTACK_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#ifndef COLUMN_SCHEMA_TYPEDEF
+#define COLUMN_SCHEMA_TYPEDEF // guards column typedef shared by column data structure headers from redefinition
+
+/// @brief Single column of record, i.e. field's offset in record and its size. Based on 'offsetof' and 'sizeof'.
+typedef struct column {
+    size_t offset, size;
+} column_s;
+
+#endif // COLUMN_SCHEMA_TYPEDEF
+
+typedef struct scstack {
+    sstack_s * columns; // one stack per column, each with a contiguous array of that column's fields
+    column_s * schema; // copy of column schema, allocated with columns
+    char * scratch; // single record to gather records into when destroying, allocated with columns
+    size_t count; // number of columns
+} scstack_s;
+
+/// @brief Creates empty struct-of-arrays stack described by column schema.
+/// @param schema Array of columns, i.e. offset and size of each of record's fields to keep.
+/// @param count Number of columns.
+/// @return Empty stack structure.
+scstack_s scst_create(column_s const * schema, const size_t count);
+
+/// @brief Destroys a stack.
+/// @param stack Stack data structure.
+/// @param destroy Function pointer to destroy a single record gathered from stack's columns.
+void scst_destroy(scstack_s * stack, const destroy_fn destroy);
+
+/// @brief Checks if stack is empty.
+/// @param stack Stack data structure.
+/// @return 'true' if stack is empty, 'false' otherwise.
+bool scst_is_empty(const scstack_s stack);
+
+/// @brief Pushes record on top of stack, scattering its fields into columns.
+/// @param stack Stack data structure.
+/// @param record Single record to push.
+void scst_push(scstack_s * stack, const void * record);
+
+/// @brief Gathers top record of stack from columns without popping it.
+/// @param stack Stack data structure.
+/// @param record Record buffer to gather fields into, bytes outside of schema's columns are left as they are.
+void scst_peep(const scstack_s stack, void * record);
+
+/// @brief Pops top record of stack, gathering its fields from columns.
+/// @param stack Stack data structure.
+/// @param record Record buffer to gather fields into, bytes outside of schema's columns are left as they are.
+void scst_pop(scstack_s * stack, void * record);
+
+/// @brief Iterates over each field in a single column from bottom to top of stack.
+/// @param stack Stack data structure.
+/// @param column Index of column in schema.
+/// @param operate Function pointer to perform a single operation on field in column using arguments.
+/// @param arguments Generic arguments for function pointer.
+void scst_foreach_column(scstack_s const * stack, const size_t column, const operate_fn operate, void * arguments);
+
+/// @brief Maps a single column into its contiguous array of fields to manage, without touching other columns.
+/// @param stack Stack data structure.
+/// @param column Index of column in schema.
+/// @param manage Function pointer to manage an array of finite number of fields in column.
+/// @param arguments Generic arguments for function pointer.
+void scst_map_column(scstack_s const * stack, const size_t column, const manage_fn manage, void * arguments);
+
+#endif // SCSTACK_H
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef SESTACK_H
+#define SESTACK_H
+
+#include <scale/sequential/stack/sstack.h>
+
+#ifndef COMPARE_FUNCTION_TYPEDEF
+#define COMPARE_FUNCTION_TYPEDEF // guards comparator typedef shared by ordered data structure headers from redefinition
+
+/// @brief Function pointer to compare two elements in data structure. Based on 'qsort' comparators.
+typedef int (*compare_fn) (const void * a, const void * b);
+
+#endif // COMPARE_FUNCTION_TYPEDEF
+
+typedef struct sestack {
+    sstack_s stack; // stack of elements
+    sstack_s minima, maxima; // indexes of elements that were strictly smaller or larger than every element below them
+    compare_fn compare; // comparator that orders elements from minimum to maximum
+} sestack_s;
+
+/// @brief Creates empty stack that tracks its minimum and maximum element.
+/// @param compare Comparator, elements are ordered from minimum to maximum.
+/// @return Empty stack structure.
+sestack_s sest_create(const compare_fn compare);
+
+/// @brief Destroys a stack.
+/// @param stack Stack data structure.
+/// @param destroy Function pointer to destroy a single element in stack.
+/// @param element_size Size of a single element.
+void sest_destroy(sestack_s * stack, const destroy_fn destroy, const size_t element_size);
+
+/// @brief Checks if stack is empty.
+/// @param stack Stack data structure.
+/// @return 'true' if stack is empty, 'false' otherwise.
+bool sest_is_empty(const sestack_s stack);
+
+/// @brief Pushes element on top of stack, recording its index only if it's a new extremum.
+/// @param stack Stack data structure.
+/// @param element Single element to push.
+/// @param element_size Size of a single element.
+void sest_push(sestack_s * stack, const void * element, const size_t element_size);
+
+/// @brief Pushes array of elements, comparing each only against running extrema.
+/// @param stack Stack data structure.
+/// @param elements Array of elements to push, last one ends on top.
+/// @param n Number of elements to push.
+/// @param element_size Size of a single element.
+void sest_push_n(sestack_s * stack, const void * elements, const size_t n, const size_t element_size);
+
+/// @brief Copies top element of stack without popping it.
+/// @param stack Stack data structure.
+/// @param element Element buffer to copy top element into.
+/// @param element_size Size of a single element.
+void sest_peep(const sestack_s stack, void * element, const size_t element_size);
+
+/// @brief Pops top element of stack, dropping its extrema records if it had any.
+/// @param stack Stack data structure.
+/// @param element Element buffer to copy popped element into.
+/// @param element_size Size of a single element.
+void sest_pop(sestack_s * stack, void * element, const size_t element_size);
+
+/// @brief Pops 'n' top elements of stack, dropping only extrema records of popped elements.
+/// @param stack Stack data structure.
+/// @param elements Array of at least 'n' elements to copy popped elements into, from top to bottom.
+/// @param n Number of elements to pop.
+/// @param element_size Size of a single element.
+void sest_pop_n(sestack_s * stack, void * elements, const size_t n, const size_t element_size);
+
+/// @brief Copies minimum element of stack in constant time.
+/// @param stack Stack data structure.
+/// @param element Element buffer to copy minimum element into.
+/// @param element_size Size of a single element.
+/// @note Out of equal minimum elements the lowest one in stack is copied.
+void sest_minimum(const sestack_s stack, void * element, const size_t element_size);
+
+/// @brief Copies maximum element of stack in constant time.
+/// @param stack Stack data structure.
+/// @param element Element buffer to copy maximum element into.
+/// @param element_size Size of a single element.
+/// @note Out of equal maximum elements the lowest one in stack is copied.
+void sest_maximum(const sestack_s stack, void * element, const size_t element_size);
+
+#endif // SESTACK_H
\ No newline at end of file
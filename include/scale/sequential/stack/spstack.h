@@ -0,0 +1,78 @@
+#ifndef SPSTACK_H
+#define SPSTACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+typedef struct spstack {
+    uint64_t * words; // array of words, each packing '64 / width' values from lowest bits up, unused bits are zero
+    size_t size; // number of values in stack
+    size_t width; // number of bits in a single value
+} spstack_s;
+
+/// @brief Creates empty stack of bit-packed values.
+/// @param width Number of bits in a single value, from 1 to 64.
+/// @return Empty stack structure.
+/// @note Values don't straddle words, so widths that don't divide 64 leave the highest bits of each word unused.
+spstack_s spst_create(const size_t width);
+
+/// @brief Destroys a stack.
+/// @param stack Stack data structure.
+void spst_destroy(spstack_s * stack);
+
+/// @brief Checks if stack is empty.
+/// @param stack Stack data structure.
+/// @return 'true' if stack is empty, 'false' otherwise.
+bool spst_is_empty(const spstack_s stack);
+
+/// @brief Pushes value to the top of the stack.
+/// @param stack Stack data structure.
+/// @param value Value that fits into stack's width.
+void spst_push(spstack_s * stack, const uint64_t value);
+
+/// @brief Peeps the top of the stack.
+/// @param stack Stack data structure.
+/// @return Top value.
+uint64_t spst_peep(const spstack_s stack);
+
+/// @brief Pops value from the top of the stack.
+/// @param stack Stack data structure.
+/// @return Popped value.
+uint64_t spst_pop(spstack_s * stack);
+
+/// @brief Counts values equal to value a word at a time, i.e. a popcount for 1-bit stacks.
+/// @param stack Stack data structure.
+/// @param value Value that fits into stack's width.
+/// @return Number of values in stack equal to value.
+size_t spst_count(spstack_s const * stack, const uint64_t value);
+
+/// @brief Scans stack a word at a time from top to bottom for value.
+/// @param stack Stack data structure.
+/// @param value Value that fits into stack's width.
+/// @return Depth of topmost equal value, where '0' is the top, or stack's size if value isn't in stack.
+size_t spst_find(spstack_s const * stack, const uint64_t value);
+
+/// @brief Maps stack's packed words into an array to manage.
+/// @param stack Stack data structure.
+/// @param manage Function pointer to manage an array of words, where last word may be partially used.
+/// @param arguments Generic arguments for function pointer.
+void spst_map(spstack_s const * stack, const manage_fn manage, void * arguments);
+
+#endif // SPSTACK_H
\ No newline at end of file
@@ -9,6 +9,15 @@ typedef struct sstack {
     size_t size; // number of elements in stack
 } sstack_s;
 
+typedef struct sstack_cursor {
+    char * element; // pointer to current element
+    size_t left; // number of elements left to iterate, including current
+    ptrdiff_t step; // signed distance in bytes to next element
+} sstack_cursor_s;
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
 /// @brief Function pointer to destroy a single element in data structure. Based on 'free';
 typedef void   (*destroy_fn) (void * element);
 /// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
@@ -17,6 +26,10 @@ typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
 typedef bool   (*operate_fn) (void * element, size_t size, void * args);
 /// @brief Function pointer to manage an array of finite number of element in data structure.
 typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
 
 /// @brief Creates empty stack.
 /// @return Empty stack structure.
@@ -77,4 +90,48 @@ void sstk_foreach(sstack_s const * stack, const operate_fn operate, const size_t
 /// @param arguments Generic arguments for function pointer.
 void sstk_map(sstack_s const * stack, const manage_fn manage, const size_t element_size, void * arguments);
 
+/// @brief Splits stack's elements into chunks and manages each chunk on a separate thread.
+/// @param stack Stack data structure.
+/// @param manage Function pointer to manage a single chunk of elements in stack.
+/// @param merge Function pointer to merge two adjacent managed chunks, or NULL to leave chunks as they are.
+/// @param thread_count Maximum number of threads, including calling thread, to manage chunks with.
+/// @param element_size Size of a single element.
+/// @param arguments Generic arguments for function pointers.
+/// @note Chunks are merged pairwise in rounds, with merges of the same round running in parallel.
+void sstk_map_parallel(sstack_s const * stack, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments);
+
+/// @brief Creates cursor at the bottom of the stack that iterates towards the top.
+/// @param stack Stack data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the bottom element, or ended cursor if stack is empty.
+/// @note Cursor is invalidated by any operation that changes the stack's size.
+static inline sstack_cursor_s sstk_begin(sstack_s const * stack, const size_t element_size) {
+    return (sstack_cursor_s) { .element = stack->elements, .left = stack->size, .step = (ptrdiff_t)element_size, };
+}
+
+/// @brief Creates cursor at the top of the stack that iterates towards the bottom.
+/// @param stack Stack data structure.
+/// @param element_size Size of a single element.
+/// @return Cursor pointing to the top element, or ended cursor if stack is empty.
+/// @note Cursor is invalidated by any operation that changes the stack's size.
+static inline sstack_cursor_s sstk_rbegin(sstack_s const * stack, const size_t element_size) {
+    char * top = stack->size ? (char*)(stack->elements) + ((stack->size - 1) * element_size) : stack->elements;
+    return (sstack_cursor_s) { .element = top, .left = stack->size, .step = -(ptrdiff_t)element_size, };
+}
+
+/// @brief Checks if cursor went past the last element.
+/// @param cursor Stack cursor.
+/// @return 'true' if there are no more elements to iterate, 'false' otherwise.
+static inline bool sstk_end(const sstack_cursor_s cursor) {
+    return !(cursor.left);
+}
+
+/// @brief Moves cursor to the next element.
+/// @param cursor Stack cursor that has not ended.
+static inline void sstk_next(sstack_cursor_s * cursor) {
+    if (--cursor->left) { // don't move pointer before array's start when reverse iteration ends
+        cursor->element += cursor->step;
+    }
+}
+
 #endif // SSTACK_H
@@ -0,0 +1,159 @@
+#include <scale/concurrent/deque/cdeque.h>
+
+#include <string.h>
+
+#ifndef ASSERT_CDEQ
+#   include <assert.h>
+#   define ASSERT_CDEQ assert
+#endif
+
+#if !defined(REALLOC_CDEQ) && !defined(FREE_CDEQ)
+#   include <stdlib.h>
+#   ifndef REALLOC_CDEQ
+#       define REALLOC_CDEQ realloc
+#   endif
+#   ifndef FREE_CDEQ
+#       define FREE_CDEQ free
+#   endif
+#elif !defined(REALLOC_CDEQ)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_CDEQ)
+#   error Free macro is not defined!
+#endif
+
+#ifndef INITIAL_CAPACITY_CDEQ
+#   define INITIAL_CAPACITY_CDEQ (1 << 5)
+#elif INITIAL_CAPACITY_CDEQ <= 0 || (INITIAL_CAPACITY_CDEQ & (INITIAL_CAPACITY_CDEQ - 1))
+#   error 'INITIAL_CAPACITY_CDEQ' must be a power of two greater than 0
+#endif
+
+struct cdeque_array {
+    struct cdeque_array * retired; // previous smaller array that thieves may still be reading from
+    size_t capacity; // power of two capacity of elements array
+    char elements[]; // circular array of elements
+};
+
+/// @brief Calculates pointer to element at deque index in circular array.
+static char * array_at(struct cdeque_array * array, const ptrdiff_t index, const size_t element_size) {
+    return array->elements + (((size_t)index & (array->capacity - 1)) * element_size);
+}
+
+static struct cdeque_array * array_create(const size_t capacity, const size_t element_size) {
+    struct cdeque_array * array = REALLOC_CDEQ(NULL, sizeof(struct cdeque_array) + (capacity * element_size));
+    ASSERT_CDEQ(array && "[ERROR] Memory allocation failed.");
+
+    array->retired = NULL;
+    array->capacity = capacity;
+
+    return array;
+}
+
+cdeque_s cdeq_create(const size_t element_size) {
+    ASSERT_CDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    return (cdeque_s) { .array = array_create(INITIAL_CAPACITY_CDEQ, element_size), };
+}
+
+void cdeq_destroy(cdeque_s * deque, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_CDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_CDEQ(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_CDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (ptrdiff_t i = deque->rear; i < deque->front; ++i) {
+        destroy(array_at(deque->array, i, element_size));
+    }
+
+    // free current array and every retired array before it
+    for (struct cdeque_array * array = deque->array; array;) {
+        struct cdeque_array * retired = array->retired;
+        FREE_CDEQ(array);
+        array = retired;
+    }
+
+    (*deque) = (cdeque_s) { 0 };
+}
+
+bool cdeq_is_empty(cdeque_s const * deque) {
+    ASSERT_CDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+
+    const ptrdiff_t rear = __atomic_load_n(&deque->rear, __ATOMIC_ACQUIRE);
+    const ptrdiff_t front = __atomic_load_n(&deque->front, __ATOMIC_ACQUIRE);
+    return front <= rear;
+}
+
+void cdeq_enqueue_front(cdeque_s * deque, const void * element, const size_t element_size) {
+    ASSERT_CDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_CDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    const ptrdiff_t front = __atomic_load_n(&deque->front, __ATOMIC_RELAXED);
+    const ptrdiff_t rear = __atomic_load_n(&deque->rear, __ATOMIC_ACQUIRE);
+    struct cdeque_array * array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+
+    if ((size_t)(front - rear) >= array->capacity) { // if array is full double it and keep old one for thieves
+        ASSERT_CDEQ((array->capacity << 1) && "[ERROR] Deque's capacity will overflow.");
+        struct cdeque_array * expand = array_create(array->capacity << 1, element_size);
+
+        for (ptrdiff_t i = rear; i < front; ++i) {
+            memcpy(array_at(expand, i, element_size), array_at(array, i, element_size), element_size);
+        }
+        expand->retired = array;
+
+        __atomic_store_n(&deque->array, expand, __ATOMIC_RELEASE);
+        array = expand;
+    }
+
+    memcpy(array_at(array, front, element_size), element, element_size);
+    __atomic_store_n(&deque->front, front + 1, __ATOMIC_RELEASE); // publish element to thieves
+}
+
+bool cdeq_dequeue_front(cdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_CDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_CDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    const ptrdiff_t front = __atomic_load_n(&deque->front, __ATOMIC_RELAXED) - 1;
+    struct cdeque_array * array = __atomic_load_n(&deque->array, __ATOMIC_RELAXED);
+
+    // reserve front element before looking at rear, so that thieves and owner can't both take it
+    __atomic_store_n(&deque->front, front, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    ptrdiff_t rear = __atomic_load_n(&deque->rear, __ATOMIC_RELAXED);
+
+    if (rear > front) { // deque was empty, so undo reservation
+        __atomic_store_n(&deque->front, front + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    memcpy(element, array_at(array, front, element_size), element_size);
+    if (rear < front) { // more than one element left, so thieves can't reach reserved one
+        return true;
+    }
+
+    // last element, so race thieves for it by advancing rear
+    const bool is_taken = __atomic_compare_exchange_n(&deque->rear, &rear, rear + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->front, front + 1, __ATOMIC_RELAXED);
+
+    return is_taken;
+}
+
+bool cdeq_dequeue_rear(cdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_CDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_CDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    ptrdiff_t rear = __atomic_load_n(&deque->rear, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    const ptrdiff_t front = __atomic_load_n(&deque->front, __ATOMIC_ACQUIRE);
+
+    if (rear >= front) {
+        return false;
+    }
+
+    // copy element before claiming it, since owner may reuse its slot right after rear moves. If the
+    // slot is overwritten while copying, rear has already moved and the failed exchange discards the copy.
+    struct cdeque_array * array = __atomic_load_n(&deque->array, __ATOMIC_ACQUIRE);
+    memcpy(element, array_at(array, rear, element_size), element_size);
+
+    return __atomic_compare_exchange_n(&deque->rear, &rear, rear + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <scale/concurrent/deque/fcdeque.h>
+
+#include <stdint.h>
+#include <sched.h>
+
+#ifndef ASSERT_FCDEQ
+#   include <assert.h>
+#   define ASSERT_FCDEQ assert
+#endif
+
+#if !defined(REALLOC_FCDEQ) && !defined(FREE_FCDEQ)
+#   include <stdlib.h>
+#   ifndef REALLOC_FCDEQ
+#       define REALLOC_FCDEQ realloc
+#   endif
+#   ifndef FREE_FCDEQ
+#       define FREE_FCDEQ free
+#   endif
+#elif !defined(REALLOC_FCDEQ)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_FCDEQ)
+#   error Free macro is not defined!
+#endif
+
+#ifndef REQUEST_COUNT_FCDEQ
+#   define REQUEST_COUNT_FCDEQ (1 << 6) // number of publication slots, more concurrent threads wait for a free slot
+#elif REQUEST_COUNT_FCDEQ <= 0
+#   error 'REQUEST_COUNT_FCDEQ' must be greater than 0
+#endif
+
+#ifndef SPIN_COUNT_FCDEQ
+#   define SPIN_COUNT_FCDEQ (1 << 6) // number of checks a waiting thread makes before it starts yielding
+#elif SPIN_COUNT_FCDEQ < 0
+#   error 'SPIN_COUNT_FCDEQ' cannot be less than 0
+#endif
+
+/// States of a publication slot, only the thread that claimed slot sets it back to free.
+enum request_state { REQUEST_FREE, REQUEST_CLAIMED, REQUEST_PENDING, REQUEST_DONE, };
+/// Operations a thread can publish for the combiner.
+enum request_operation {
+    OPERATION_ENQUEUE_FRONT, OPERATION_ENQUEUE_REAR, OPERATION_PEEK_FRONT, OPERATION_PEEK_REAR,
+    OPERATION_DEQUEUE_FRONT, OPERATION_DEQUEUE_REAR,
+};
+
+struct fcdeque_request {
+    size_t state; // request state, changed with acquire/release so operands and result are published with it
+    enum request_operation operation; // operation to apply on deque
+    void * element; // caller's element to enqueue from or to save into
+    size_t element_size; // size of caller's element
+    bool result; // 'false' if operation found deque empty
+    char padding[CACHE_LINE_FCDEQ]; // keeps slots of different threads on separate cache lines
+};
+
+/// @brief Publishes operation, then either waits for the combiner to apply it or becomes the combiner.
+/// @param deque Deque data structure.
+/// @param operation Operation to apply.
+/// @param element Caller's element.
+/// @param element_size Size of a single element.
+/// @return Result of operation.
+static bool publish(fcdeque_s * deque, const enum request_operation operation, void * element, const size_t element_size);
+
+/// @brief Applies every pending request on the underlying deque while holding combiner lock.
+/// @param deque Deque data structure.
+static void combine(fcdeque_s * deque);
+
+fcdeque_s fcdeq_create(void) {
+    fcdeque_s deque = { .deque = sdeq_create(), .lock = 0, };
+    deque.requests = REALLOC_FCDEQ(NULL, REQUEST_COUNT_FCDEQ * sizeof(struct fcdeque_request));
+    ASSERT_FCDEQ(deque.requests && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < REQUEST_COUNT_FCDEQ; ++i) {
+        deque.requests[i].state = REQUEST_FREE;
+    }
+
+    return deque;
+}
+
+void fcdeq_destroy(fcdeque_s * deque, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    sdeq_destroy(&deque->deque, destroy, element_size);
+    FREE_FCDEQ(deque->requests);
+    (*deque) = (fcdeque_s) { 0 };
+}
+
+void fcdeq_enqueue_front(fcdeque_s * deque, const void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    // element is only read by combiner, so casting away const never writes into it
+    publish(deque, OPERATION_ENQUEUE_FRONT, (void*)element, element_size);
+}
+
+void fcdeq_enqueue_rear(fcdeque_s * deque, const void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    // element is only read by combiner, so casting away const never writes into it
+    publish(deque, OPERATION_ENQUEUE_REAR, (void*)element, element_size);
+}
+
+bool fcdeq_peek_front(fcdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(deque, OPERATION_PEEK_FRONT, element, element_size);
+}
+
+bool fcdeq_peek_rear(fcdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(deque, OPERATION_PEEK_REAR, element, element_size);
+}
+
+bool fcdeq_dequeue_front(fcdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(deque, OPERATION_DEQUEUE_FRONT, element, element_size);
+}
+
+bool fcdeq_dequeue_rear(fcdeque_s * deque, void * element, const size_t element_size) {
+    ASSERT_FCDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_FCDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(deque, OPERATION_DEQUEUE_REAR, element, element_size);
+}
+
+static bool publish(fcdeque_s * deque, const enum request_operation operation, void * element, const size_t element_size) {
+    // start probing at the slot calling thread claimed last, so threads tend to keep separate slots
+    static __thread size_t slot = 0; // claimed slot's index plus one, zero until seeded; GCC-only like the atomic builtins
+    if (!slot) { // seed from hash of thread-local's address, whose higher bits differ for each thread
+        slot = (size_t)((((uint64_t)(uintptr_t)&slot * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % REQUEST_COUNT_FCDEQ) + 1;
+    }
+    size_t index = slot - 1;
+    struct fcdeque_request * request = NULL;
+    for (size_t attempt = 0; !request; ++attempt, index = (index + 1) % REQUEST_COUNT_FCDEQ) {
+        size_t expected = REQUEST_FREE;
+        if (__atomic_compare_exchange_n(&deque->requests[index].state, &expected, REQUEST_CLAIMED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            request = &deque->requests[index];
+        } else if (attempt >= REQUEST_COUNT_FCDEQ) {
+            sched_yield();
+        }
+    }
+
+    slot = (size_t)(request - deque->requests) + 1;
+
+    request->operation = operation;
+    request->element = element;
+    request->element_size = element_size;
+    __atomic_store_n(&request->state, REQUEST_PENDING, __ATOMIC_RELEASE);
+
+    for (size_t attempt = 0; REQUEST_DONE != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE); ++attempt) {
+        size_t expected = 0;
+        if (!__atomic_load_n(&deque->lock, __ATOMIC_RELAXED) && __atomic_compare_exchange_n(&deque->lock, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            combine(deque);
+            __atomic_store_n(&deque->lock, 0, __ATOMIC_RELEASE);
+        } else if (attempt >= SPIN_COUNT_FCDEQ) {
+            sched_yield();
+        }
+    }
+
+    const bool result = request->result;
+    __atomic_store_n(&request->state, REQUEST_FREE, __ATOMIC_RELEASE);
+
+    return result;
+}
+
+static void combine(fcdeque_s * deque) {
+    for (size_t i = 0; i < REQUEST_COUNT_FCDEQ; ++i) {
+        struct fcdeque_request * request = &deque->requests[i];
+        if (REQUEST_PENDING != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+
+        request->result = true;
+        switch (request->operation) {
+            case OPERATION_ENQUEUE_FRONT: {
+                sdeq_enqueue_front(&deque->deque, request->element, request->element_size);
+            } break;
+            case OPERATION_ENQUEUE_REAR: {
+                sdeq_enqueue_rear(&deque->deque, request->element, request->element_size);
+            } break;
+            case OPERATION_PEEK_FRONT: {
+                request->result = !sdeq_is_empty(deque->deque);
+                if (request->result) {
+                    sdeq_peek_front(deque->deque, request->element, request->element_size);
+                }
+            } break;
+            case OPERATION_PEEK_REAR: {
+                request->result = !sdeq_is_empty(deque->deque);
+                if (request->result) {
+                    sdeq_peek_rear(deque->deque, request->element, request->element_size);
+                }
+            } break;
+            case OPERATION_DEQUEUE_FRONT: {
+                request->result = !sdeq_is_empty(deque->deque);
+                if (request->result) {
+                    sdeq_dequeue_front(&deque->deque, request->element, request->element_size);
+                }
+            } break;
+            case OPERATION_DEQUEUE_REAR: {
+                request->result = !sdeq_is_empty(deque->deque);
+                if (request->result) {
+                    sdeq_dequeue_rear(&deque->deque, request->element, request->element_size);
+                }
+            } break;
+        }
+
+        __atomic_store_n(&request->state, REQUEST_DONE, __ATOMIC_RELEASE);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <scale/concurrent/pool/mpool.h>
+
+#ifndef ASSERT_MPOOL
+#   include <assert.h>
+#   define ASSERT_MPOOL assert
+#endif
+
+#if !defined(REALLOC_MPOOL) && !defined(FREE_MPOOL)
+#   include <stdlib.h>
+#   ifndef REALLOC_MPOOL
+#       define REALLOC_MPOOL realloc
+#   endif
+#   ifndef FREE_MPOOL
+#       define FREE_MPOOL free
+#   endif
+#elif !defined(REALLOC_MPOOL)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_MPOOL)
+#   error Free macro is not defined!
+#endif
+
+mpool_s mpool_create(const size_t magazine_size) {
+    ASSERT_MPOOL(magazine_size && "[ERROR] Magazine's size can't be zero.");
+
+    mpool_s pool = { .depot = sstk_create(), .magazine_size = magazine_size, };
+
+    pool.mutex = REALLOC_MPOOL(NULL, sizeof(pthread_mutex_t));
+    ASSERT_MPOOL(pool.mutex && "[ERROR] Memory allocation failed.");
+
+    const int error = pthread_mutex_init(pool.mutex, NULL);
+    ASSERT_MPOOL(!error && "[ERROR] Mutex initialization failed.");
+    (void)(error);
+
+    return pool;
+}
+
+void mpool_destroy(mpool_s * pool, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_MPOOL(pool && "[ERROR] 'pool' parameter is NULL.");
+    ASSERT_MPOOL(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_MPOOL(element_size && "[ERROR] Element's size can't be zero.");
+
+    while (!sstk_is_empty(pool->depot)) {
+        sstack_s magazine = { 0 };
+        sstk_pop(&pool->depot, &magazine, sizeof(sstack_s));
+        sstk_destroy(&magazine, destroy, element_size);
+    }
+
+    pthread_mutex_destroy(pool->mutex);
+    FREE_MPOOL(pool->mutex);
+    (*pool) = (mpool_s) { 0 };
+}
+
+mpool_cache_s mpool_cache_create(void) {
+    return (mpool_cache_s) { .loaded = sstk_create(), .previous = sstk_create(), };
+}
+
+void mpool_cache_destroy(mpool_s * pool, mpool_cache_s * cache, const size_t element_size) {
+    ASSERT_MPOOL(pool && "[ERROR] 'pool' parameter is NULL.");
+    ASSERT_MPOOL(cache && "[ERROR] 'cache' parameter is NULL.");
+    ASSERT_MPOOL(element_size && "[ERROR] Element's size can't be zero.");
+    (void)(element_size);
+
+    // empty magazines hold no memory, since sstack frees its array once its last element is poped
+    pthread_mutex_lock(pool->mutex);
+    if (!sstk_is_empty(cache->loaded)) {
+        sstk_push(&pool->depot, &cache->loaded, sizeof(sstack_s));
+    }
+    if (!sstk_is_empty(cache->previous)) {
+        sstk_push(&pool->depot, &cache->previous, sizeof(sstack_s));
+    }
+    pthread_mutex_unlock(pool->mutex);
+
+    (*cache) = (mpool_cache_s) { 0 };
+}
+
+bool mpool_get(mpool_s * pool, mpool_cache_s * cache, void * element, const size_t element_size) {
+    ASSERT_MPOOL(pool && "[ERROR] 'pool' parameter is NULL.");
+    ASSERT_MPOOL(cache && "[ERROR] 'cache' parameter is NULL.");
+    ASSERT_MPOOL(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MPOOL(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (sstk_is_empty(cache->loaded)) {
+        if (!sstk_is_empty(cache->previous)) { // previous magazine still has elements, so swap it in without locking
+            const sstack_s swap = cache->loaded;
+            cache->loaded = cache->previous;
+            cache->previous = swap;
+        } else { // both magazines are empty, so exchange the empty loaded one for a full one from depot
+            pthread_mutex_lock(pool->mutex);
+            const bool has_full = !sstk_is_empty(pool->depot);
+            if (has_full) {
+                sstk_pop(&pool->depot, &cache->loaded, sizeof(sstack_s));
+            }
+            pthread_mutex_unlock(pool->mutex);
+
+            if (!has_full) {
+                return false;
+            }
+        }
+    }
+
+    sstk_pop(&cache->loaded, element, element_size);
+    return true;
+}
+
+void mpool_put(mpool_s * pool, mpool_cache_s * cache, const void * element, const size_t element_size) {
+    ASSERT_MPOOL(pool && "[ERROR] 'pool' parameter is NULL.");
+    ASSERT_MPOOL(cache && "[ERROR] 'cache' parameter is NULL.");
+    ASSERT_MPOOL(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MPOOL(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (cache->loaded.size >= pool->magazine_size) {
+        if (cache->previous.size < pool->magazine_size) { // previous magazine still has room, so swap it in without locking
+            const sstack_s swap = cache->loaded;
+            cache->loaded = cache->previous;
+            cache->previous = swap;
+        } else { // both magazines are full, so hand previous one to depot and start an empty one
+            pthread_mutex_lock(pool->mutex);
+            sstk_push(&pool->depot, &cache->previous, sizeof(sstack_s));
+            pthread_mutex_unlock(pool->mutex);
+
+            cache->previous = cache->loaded;
+            cache->loaded = sstk_create();
+        }
+    }
+
+    sstk_push(&cache->loaded, element, element_size);
+}
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include <scale/concurrent/pool/tpool.h>
+#include <scale/concurrent/deque/cdeque.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+
+#ifndef ASSERT_TPOOL
+#   include <assert.h>
+#   define ASSERT_TPOOL assert
+#endif
+
+#if !defined(REALLOC_TPOOL) && !defined(FREE_TPOOL)
+#   include <stdlib.h>
+#   ifndef REALLOC_TPOOL
+#       define REALLOC_TPOOL realloc
+#   endif
+#   ifndef FREE_TPOOL
+#       define FREE_TPOOL free
+#   endif
+#elif !defined(REALLOC_TPOOL)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_TPOOL)
+#   error Free macro is not defined!
+#endif
+
+#ifndef CACHE_LINE_TPOOL
+#   define CACHE_LINE_TPOOL 64 // size of a single cache line in bytes used to separate workers
+#endif
+
+#ifndef SPIN_COUNT_TPOOL
+#   define SPIN_COUNT_TPOOL (1 << 6) // number of failed attempts to find a task before idle worker goes to sleep
+#elif SPIN_COUNT_TPOOL < 0
+#   error 'SPIN_COUNT_TPOOL' cannot be less than 0
+#endif
+
+struct task {
+    task_fn function; // function to run
+    void * argument; // argument passed to function
+    tpool_group_s * group; // group counting task
+};
+
+struct range_task {
+    range_fn body; // function to run chunk of iterations
+    void * argument; // argument passed to body
+    size_t begin, end; // chunk of iterations
+};
+
+struct tpool_worker {
+    cdeque_s deque; // worker's own tasks, pushed and poped at front by worker and stolen from rear by others
+    pthread_t thread; // worker thread
+    struct tpool_runtime * runtime; // runtime worker belongs to
+    uint64_t seed; // state of worker's victim picking generator
+    char padding[CACHE_LINE_TPOOL];
+};
+
+struct tpool_runtime {
+    struct tpool_worker * workers; // array of workers
+    size_t worker_count; // number of workers
+    size_t started; // number of workers whose thread was created, only those are joined
+    pthread_key_t key; // maps worker threads to their worker structure
+
+    squeue_s injection; // tasks spawned by threads outside of pool, guarded by mutex
+    pthread_mutex_t mutex; // guards injection queue and sleeping
+    pthread_cond_t wake; // signaled when a task is spawned while a worker sleeps
+    bool stop; // 'true' once pool is destroyed
+
+    size_t injected; // number of tasks in injection queue, read without mutex to skip empty queue
+    size_t queued; // number of tasks spawned but not yet taken by any thread
+    size_t sleepers; // number of workers sleeping or about to sleep on wake
+};
+
+/// @brief Worker thread's main loop.
+/// @param argument Worker structure.
+/// @return NULL.
+static void * work(void * argument);
+
+/// @brief Takes task from own deque, injection queue or a random victim's deque, in that order.
+/// @param runtime Runtime of pool.
+/// @param self Worker of calling thread or NULL if thread is not a worker.
+/// @param seed State of victim picking generator.
+/// @param task Task to save taken task into.
+/// @return 'true' if task was taken, 'false' otherwise.
+static bool take(struct tpool_runtime * runtime, struct tpool_worker * self, uint64_t * seed, struct task * task);
+
+/// @brief Runs task and marks it as finished in its group.
+/// @param task Task to run.
+static void run(const struct task task);
+
+/// @brief Generates next number of xorshift generator.
+/// @param seed State of generator.
+/// @return Pseudo-random number.
+static uint64_t next_random(uint64_t * seed);
+
+/// @brief Runs chunk of parallel-for range.
+/// @param argument Range task structure.
+static void range_run(void * argument);
+
+/// @brief Destroys nothing, tasks don't own their arguments.
+/// @param element Task.
+static void destroy_task(void * element);
+
+tpool_s tpool_create(const size_t worker_count) {
+    ASSERT_TPOOL(worker_count && "[ERROR] Worker count can't be zero.");
+
+    struct tpool_runtime * runtime = REALLOC_TPOOL(NULL, sizeof(struct tpool_runtime));
+    ASSERT_TPOOL(runtime && "[ERROR] Memory allocation failed.");
+    (*runtime) = (struct tpool_runtime) { .worker_count = worker_count, .injection = sque_create(), };
+
+    runtime->workers = REALLOC_TPOOL(NULL, worker_count * sizeof(struct tpool_worker));
+    ASSERT_TPOOL(runtime->workers && "[ERROR] Memory allocation failed.");
+
+    int error = pthread_key_create(&runtime->key, NULL);
+    error |= pthread_mutex_init(&runtime->mutex, NULL);
+    error |= pthread_cond_init(&runtime->wake, NULL);
+    ASSERT_TPOOL(!error && "[ERROR] Thread primitive initialization failed.");
+    (void)(error);
+
+    // every deque is created before any thread starts, since workers steal from each other right away
+    for (size_t i = 0; i < worker_count; ++i) {
+        struct tpool_worker * worker = &runtime->workers[i];
+        worker->deque = cdeq_create(sizeof(struct task));
+        worker->runtime = runtime;
+        worker->seed = (uint64_t)i + 1;
+    }
+
+    // stop at first thread that can't be created, remaining workers keep empty deques and waiting threads run tasks
+    for (; runtime->started < worker_count; runtime->started++) {
+        struct tpool_worker * worker = &runtime->workers[runtime->started];
+        if (pthread_create(&worker->thread, NULL, work, worker)) {
+            break;
+        }
+    }
+
+    return (tpool_s) { .runtime = runtime, .worker_count = runtime->started, };
+}
+
+void tpool_destroy(tpool_s * pool) {
+    ASSERT_TPOOL(pool && "[ERROR] 'pool' parameter is NULL.");
+
+    struct tpool_runtime * runtime = pool->runtime;
+    pthread_mutex_lock(&runtime->mutex);
+    __atomic_store_n(&runtime->stop, true, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&runtime->wake);
+    pthread_mutex_unlock(&runtime->mutex);
+
+    for (size_t i = 0; i < runtime->started; ++i) {
+        pthread_join(runtime->workers[i].thread, NULL);
+    }
+    for (size_t i = 0; i < runtime->worker_count; ++i) {
+        cdeq_destroy(&runtime->workers[i].deque, destroy_task, sizeof(struct task));
+    }
+
+    sque_destroy(&runtime->injection, destroy_task, sizeof(struct task));
+    pthread_cond_destroy(&runtime->wake);
+    pthread_mutex_destroy(&runtime->mutex);
+    pthread_key_delete(runtime->key);
+
+    FREE_TPOOL(runtime->workers);
+    FREE_TPOOL(runtime);
+    (*pool) = (tpool_s) { 0 };
+}
+
+tpool_group_s tpool_group_create(void) {
+    return (tpool_group_s) { .pending = 0, };
+}
+
+void tpool_spawn(tpool_s pool, tpool_group_s * group, const task_fn task, void * argument) {
+    ASSERT_TPOOL(pool.runtime && "[ERROR] Pool is not created.");
+    ASSERT_TPOOL(group && "[ERROR] 'group' parameter is NULL.");
+    ASSERT_TPOOL(task && "[ERROR] 'task' parameter is NULL.");
+
+    struct tpool_runtime * runtime = pool.runtime;
+    const struct task spawned = { .function = task, .argument = argument, .group = group, };
+    __atomic_fetch_add(&group->pending, 1, __ATOMIC_RELAXED);
+
+    // counted before task becomes visible, otherwise a thief's decrement could wrap it around and keep idle workers awake
+    // sleepers announce themselves before checking queued, so either they see this task or this sees them
+    __atomic_fetch_add(&runtime->queued, 1, __ATOMIC_SEQ_CST);
+
+    struct tpool_worker * self = pthread_getspecific(runtime->key);
+    if (self) {
+        cdeq_enqueue_front(&self->deque, &spawned, sizeof(struct task));
+    } else {
+        pthread_mutex_lock(&runtime->mutex);
+        sque_enqueue(&runtime->injection, &spawned, sizeof(struct task));
+        __atomic_fetch_add(&runtime->injected, 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&runtime->mutex);
+    }
+
+    if (__atomic_load_n(&runtime->sleepers, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&runtime->mutex);
+        pthread_cond_signal(&runtime->wake);
+        pthread_mutex_unlock(&runtime->mutex);
+    }
+}
+
+void tpool_wait(tpool_s pool, tpool_group_s * group) {
+    ASSERT_TPOOL(pool.runtime && "[ERROR] Pool is not created.");
+    ASSERT_TPOOL(group && "[ERROR] 'group' parameter is NULL.");
+
+    struct tpool_runtime * runtime = pool.runtime;
+    struct tpool_worker * self = pthread_getspecific(runtime->key);
+    uint64_t local_seed = (uint64_t)(uintptr_t)group | 1;
+    uint64_t * seed = self ? &self->seed : &local_seed;
+
+    // waiting thread helps with any pending task, so that nested fork/join can't run out of workers
+    while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE)) {
+        struct task task = { 0 };
+        if (take(runtime, self, seed, &task)) {
+            run(task);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+void tpool_parallel_for(tpool_s pool, const size_t begin, const size_t end, const size_t grain, const range_fn body, void * argument) {
+    ASSERT_TPOOL(pool.runtime && "[ERROR] Pool is not created.");
+    ASSERT_TPOOL(grain && "[ERROR] Grain can't be zero.");
+    ASSERT_TPOOL(body && "[ERROR] 'body' parameter is NULL.");
+
+    if (begin >= end) {
+        return;
+    }
+
+    const size_t count = ((end - begin) + grain - 1) / grain;
+    struct range_task * ranges = REALLOC_TPOOL(NULL, count * sizeof(struct range_task));
+    ASSERT_TPOOL(ranges && "[ERROR] Memory allocation failed.");
+
+    tpool_group_s group = tpool_group_create();
+    for (size_t i = 0; i < count; ++i) {
+        const size_t first = begin + (i * grain);
+        ranges[i] = (struct range_task) {
+            .body = body, .argument = argument, .begin = first, .end = (end - first) > grain ? first + grain : end,
+        };
+        tpool_spawn(pool, &group, range_run, &ranges[i]);
+    }
+    tpool_wait(pool, &group);
+
+    FREE_TPOOL(ranges);
+}
+
+static void * work(void * argument) {
+    struct tpool_worker * self = argument;
+    struct tpool_runtime * runtime = self->runtime;
+    pthread_setspecific(runtime->key, self);
+
+    for (size_t attempt = 0; !__atomic_load_n(&runtime->stop, __ATOMIC_RELAXED);) {
+        struct task task = { 0 };
+        if (take(runtime, self, &self->seed, &task)) {
+            run(task);
+            attempt = 0;
+        } else if (attempt++ < SPIN_COUNT_TPOOL) {
+            sched_yield();
+        } else {
+            pthread_mutex_lock(&runtime->mutex);
+            __atomic_fetch_add(&runtime->sleepers, 1, __ATOMIC_SEQ_CST);
+            while (!__atomic_load_n(&runtime->queued, __ATOMIC_SEQ_CST) && !__atomic_load_n(&runtime->stop, __ATOMIC_RELAXED)) {
+                pthread_cond_wait(&runtime->wake, &runtime->mutex);
+            }
+            __atomic_fetch_sub(&runtime->sleepers, 1, __ATOMIC_RELAXED);
+            pthread_mutex_unlock(&runtime->mutex);
+            attempt = 0;
+        }
+    }
+
+    return NULL;
+}
+
+static bool take(struct tpool_runtime * runtime, struct tpool_worker * self, uint64_t * seed, struct task * task) {
+    bool is_taken = self && cdeq_dequeue_front(&self->deque, task, sizeof(struct task));
+
+    if (!is_taken && __atomic_load_n(&runtime->injected, __ATOMIC_RELAXED)) {
+        pthread_mutex_lock(&runtime->mutex);
+        is_taken = !sque_is_empty(runtime->injection);
+        if (is_taken) {
+            sque_dequeue(&runtime->injection, task, sizeof(struct task));
+            __atomic_fetch_sub(&runtime->injected, 1, __ATOMIC_RELAXED);
+        }
+        pthread_mutex_unlock(&runtime->mutex);
+    }
+
+    // steal oldest task of victims, starting at a random one so that thieves spread over workers
+    const size_t start = (size_t)(next_random(seed) % runtime->worker_count);
+    for (size_t i = 0; !is_taken && i < runtime->worker_count; ++i) {
+        struct tpool_worker * victim = &runtime->workers[(start + i) % runtime->worker_count];
+        if (victim != self) {
+            is_taken = cdeq_dequeue_rear(&victim->deque, task, sizeof(struct task));
+        }
+    }
+
+    if (is_taken) {
+        __atomic_fetch_sub(&runtime->queued, 1, __ATOMIC_RELAXED);
+    }
+
+    return is_taken;
+}
+
+static void run(const struct task task) {
+    task.function(task.argument);
+    __atomic_fetch_sub(&task.group->pending, 1, __ATOMIC_RELEASE);
+}
+
+static uint64_t next_random(uint64_t * seed) {
+    (*seed) ^= (*seed) << 13;
+    (*seed) ^= (*seed) >> 7;
+    (*seed) ^= (*seed) << 17;
+    return (*seed);
+}
+
+static void range_run(void * argument) {
+    const struct range_task * range = argument;
+    range->body(range->begin, range->end, range->argument);
+}
+
+static void destroy_task(void * element) {
+    (void)(element);
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#define _GNU_SOURCE // exposes 'syscall' and 'clock_gettime' under strict C99
+
+#include <scale/concurrent/queue/bqueue.h>
+
+#include <time.h>
+#include <sched.h>
+#include <limits.h>
+
+#ifdef __linux__
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#   include <linux/futex.h>
+#endif
+
+#ifndef ASSERT_BQUE
+#   include <assert.h>
+#   define ASSERT_BQUE assert
+#endif
+
+#if !defined(REALLOC_BQUE) && !defined(FREE_BQUE)
+#   include <stdlib.h>
+#   ifndef REALLOC_BQUE
+#       define REALLOC_BQUE realloc
+#   endif
+#   ifndef FREE_BQUE
+#       define FREE_BQUE free
+#   endif
+#elif !defined(REALLOC_BQUE)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_BQUE)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Parks calling thread on futex word while it still holds 'expected', or until timeout passes.
+/// @param word Futex word.
+/// @param expected Value word had when caller decided to park.
+/// @param remaining Maximum number of nanoseconds to park, or 'WAIT_FOREVER_BQUE'.
+static void futex_wait(uint32_t * word, const uint32_t expected, const uint64_t remaining);
+
+/// @brief Wakes threads parked on futex word.
+/// @param word Futex word.
+/// @param count Maximum number of threads to wake.
+static void futex_wake(uint32_t * word, const int count);
+
+/// @brief Gets current monotonic time.
+/// @return Current time in nanoseconds.
+static uint64_t now(void);
+
+/// @brief Waits until queue is not empty, closed or timeout passes. Returns with mutex held.
+/// @param queue Queue data structure.
+/// @param timeout Maximum number of nanoseconds to wait, or 'WAIT_FOREVER_BQUE'.
+/// @return 'true' if queue is not empty, 'false' otherwise.
+static bool wait_locked(bqueue_s * queue, const uint64_t timeout);
+
+bqueue_s bque_create(void) {
+    bqueue_s queue = { .queue = sque_create(), .closed = false, .sequence = 0, .waiters = 0, };
+
+    queue.mutex = REALLOC_BQUE(NULL, sizeof(pthread_mutex_t));
+    ASSERT_BQUE(queue.mutex && "[ERROR] Memory allocation failed.");
+
+    const int error = pthread_mutex_init(queue.mutex, NULL);
+    ASSERT_BQUE(!error && "[ERROR] Mutex initialization failed.");
+    (void)(error);
+
+    return queue;
+}
+
+void bque_destroy(bqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_BQUE(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_BQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    sque_destroy(&queue->queue, destroy, element_size);
+    pthread_mutex_destroy(queue->mutex);
+    FREE_BQUE(queue->mutex);
+    (*queue) = (bqueue_s) { 0 };
+}
+
+void bque_close(bqueue_s * queue) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    pthread_mutex_lock(queue->mutex);
+    queue->closed = true;
+    pthread_mutex_unlock(queue->mutex);
+
+    __atomic_fetch_add(&queue->sequence, 1, __ATOMIC_RELEASE);
+    futex_wake(&queue->sequence, INT_MAX);
+}
+
+bool bque_enqueue(bqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_BQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_BQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    pthread_mutex_lock(queue->mutex);
+    if (queue->closed) {
+        pthread_mutex_unlock(queue->mutex);
+        return false;
+    }
+    sque_enqueue(&queue->queue, element, element_size);
+    // consumers register as waiters while holding mutex, so this check can't miss one that is about to park
+    const bool is_waiting = __atomic_load_n(&queue->waiters, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(queue->mutex);
+
+    if (is_waiting) {
+        __atomic_fetch_add(&queue->sequence, 1, __ATOMIC_RELEASE);
+        futex_wake(&queue->sequence, 1);
+    }
+
+    return true;
+}
+
+bool bque_try_dequeue(bqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_BQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_BQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    pthread_mutex_lock(queue->mutex);
+    const bool is_dequeued = !sque_is_empty(queue->queue);
+    if (is_dequeued) {
+        sque_dequeue(&queue->queue, element, element_size);
+    }
+    pthread_mutex_unlock(queue->mutex);
+
+    return is_dequeued;
+}
+
+bool bque_dequeue_wait(bqueue_s * queue, void * element, const uint64_t timeout, const size_t element_size) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_BQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_BQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    const bool is_dequeued = wait_locked(queue, timeout);
+    if (is_dequeued) {
+        sque_dequeue(&queue->queue, element, element_size);
+    }
+    pthread_mutex_unlock(queue->mutex);
+
+    return is_dequeued;
+}
+
+size_t bque_dequeue_batch_wait(bqueue_s * queue, void * elements, const size_t max, const uint64_t timeout, const size_t element_size) {
+    ASSERT_BQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_BQUE(elements && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_BQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (!max) {
+        return 0;
+    }
+
+    size_t count = 0;
+    if (wait_locked(queue, timeout)) {
+        for (; count < max && !sque_is_empty(queue->queue); ++count) {
+            sque_dequeue(&queue->queue, (char*)elements + (count * element_size), element_size);
+        }
+    }
+    pthread_mutex_unlock(queue->mutex);
+
+    return count;
+}
+
+static bool wait_locked(bqueue_s * queue, const uint64_t timeout) {
+    const uint64_t deadline = (WAIT_FOREVER_BQUE == timeout) ? WAIT_FOREVER_BQUE : now() + timeout;
+
+    pthread_mutex_lock(queue->mutex);
+    while (sque_is_empty(queue->queue) && !queue->closed) {
+        const uint64_t current = (WAIT_FOREVER_BQUE == deadline) ? 0 : now();
+        if (current >= deadline) {
+            return false;
+        }
+
+        // sequence is read before mutex is released, so an enqueue after that changes it and futex won't park
+        const uint32_t sequence = __atomic_load_n(&queue->sequence, __ATOMIC_ACQUIRE);
+        __atomic_fetch_add(&queue->waiters, 1, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(queue->mutex);
+
+        futex_wait(&queue->sequence, sequence, (WAIT_FOREVER_BQUE == deadline) ? WAIT_FOREVER_BQUE : deadline - current);
+
+        pthread_mutex_lock(queue->mutex);
+        __atomic_fetch_sub(&queue->waiters, 1, __ATOMIC_RELAXED);
+    }
+
+    return !sque_is_empty(queue->queue);
+}
+
+#ifdef __linux__
+
+static void futex_wait(uint32_t * word, const uint32_t expected, const uint64_t remaining) {
+    if (WAIT_FOREVER_BQUE == remaining) {
+        syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+    } else {
+        const struct timespec timeout = { .tv_sec = (time_t)(remaining / 1000000000), .tv_nsec = (long)(remaining % 1000000000), };
+        syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, &timeout, NULL, 0);
+    }
+}
+
+static void futex_wake(uint32_t * word, const int count) {
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+#else
+
+// without futexes parked consumers yield until word changes, callers recheck timeout after each return
+static void futex_wait(uint32_t * word, const uint32_t expected, const uint64_t remaining) {
+    (void)(remaining);
+    if (expected == __atomic_load_n(word, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+}
+
+static void futex_wake(uint32_t * word, const int count) {
+    (void)(word);
+    (void)(count);
+}
+
+#endif
+
+static uint64_t now(void) {
+    struct timespec current;
+    clock_gettime(CLOCK_MONOTONIC, &current);
+    return ((uint64_t)current.tv_sec * 1000000000) + (uint64_t)current.tv_nsec;
+}
\ No newline at end of file
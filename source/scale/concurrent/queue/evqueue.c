@@ -0,0 +1,209 @@
+#define _POSIX_C_SOURCE 200112L // exposes 'pipe' and 'fcntl' flags under strict C99
+
+#include <scale/concurrent/queue/evqueue.h>
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#   include <sys/eventfd.h>
+#endif
+
+#ifndef ASSERT_EVQUE
+#   include <assert.h>
+#   define ASSERT_EVQUE assert
+#endif
+
+#if !defined(REALLOC_EVQUE) && !defined(FREE_EVQUE)
+#   include <stdlib.h>
+#   ifndef REALLOC_EVQUE
+#       define REALLOC_EVQUE realloc
+#   endif
+#   ifndef FREE_EVQUE
+#       define FREE_EVQUE free
+#   endif
+#elif !defined(REALLOC_EVQUE)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_EVQUE)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Opens queue's pollable descriptor and its notifier, leaving both as '-1' on failure.
+/// @param queue Queue data structure.
+static void signal_open(evqueue_s * queue);
+
+/// @brief Closes queue's pollable descriptor and its notifier.
+/// @param queue Queue data structure.
+static void signal_close(evqueue_s * queue);
+
+/// @brief Makes queue's descriptor readable.
+/// @param queue Queue data structure.
+static void signal_raise(evqueue_s * queue);
+
+/// @brief Makes queue's descriptor no longer readable, doing nothing if it already isn't.
+/// @param queue Queue data structure.
+static void signal_clear(evqueue_s * queue);
+
+evqueue_s evque_create(void) {
+    evqueue_s queue = { .queue = sque_create(), .descriptor = -1, .notifier = -1, .is_signaled = false, };
+
+    queue.mutex = REALLOC_EVQUE(NULL, sizeof(pthread_mutex_t));
+    ASSERT_EVQUE(queue.mutex && "[ERROR] Memory allocation failed.");
+
+    const int error = pthread_mutex_init(queue.mutex, NULL);
+    ASSERT_EVQUE(!error && "[ERROR] Mutex initialization failed.");
+    (void)(error);
+
+    signal_open(&queue);
+
+    return queue;
+}
+
+void evque_destroy(evqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_EVQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_EVQUE(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_EVQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    sque_destroy(&queue->queue, destroy, element_size);
+    pthread_mutex_destroy(queue->mutex);
+    FREE_EVQUE(queue->mutex);
+    signal_close(queue);
+    (*queue) = (evqueue_s) { .descriptor = -1, .notifier = -1, };
+}
+
+bool evque_is_empty(evqueue_s * queue) {
+    ASSERT_EVQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    pthread_mutex_lock(queue->mutex);
+    const bool is_empty = sque_is_empty(queue->queue);
+    pthread_mutex_unlock(queue->mutex);
+
+    return is_empty;
+}
+
+void evque_enqueue(evqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_EVQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_EVQUE(-1 != queue->descriptor && "[ERROR] Queue has no descriptor.");
+    ASSERT_EVQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_EVQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    pthread_mutex_lock(queue->mutex);
+    sque_enqueue(&queue->queue, element, element_size);
+    const bool is_transition = !queue->is_signaled;
+    queue->is_signaled = true;
+    pthread_mutex_unlock(queue->mutex);
+
+    // signaling outside mutex keeps a woken event loop from immediately blocking on it
+    if (is_transition) {
+        signal_raise(queue);
+    }
+}
+
+void evque_enqueue_n(evqueue_s * queue, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_EVQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_EVQUE(-1 != queue->descriptor && "[ERROR] Queue has no descriptor.");
+    ASSERT_EVQUE((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_EVQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (!n) {
+        return;
+    }
+
+    pthread_mutex_lock(queue->mutex);
+    for (size_t i = 0; i < n; ++i) {
+        sque_enqueue(&queue->queue, (char const*)elements + (i * element_size), element_size);
+    }
+    const bool is_transition = !queue->is_signaled;
+    queue->is_signaled = true;
+    pthread_mutex_unlock(queue->mutex);
+
+    if (is_transition) {
+        signal_raise(queue);
+    }
+}
+
+size_t evque_dequeue_batch(evqueue_s * queue, void * elements, const size_t max, const size_t element_size) {
+    ASSERT_EVQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_EVQUE(-1 != queue->descriptor && "[ERROR] Queue has no descriptor.");
+    ASSERT_EVQUE((elements || !max) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_EVQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    pthread_mutex_lock(queue->mutex);
+    size_t count = 0;
+    for (; count < max && !sque_is_empty(queue->queue); ++count) {
+        sque_dequeue(&queue->queue, (char*)elements + (count * element_size), element_size);
+    }
+    // clearing under mutex can't swallow a later transition's signal, only one still in flight for drained elements,
+    // in which case the late signal causes a spurious wakeup whose empty drain clears it again
+    if (sque_is_empty(queue->queue)) {
+        signal_clear(queue);
+        queue->is_signaled = false;
+    }
+    pthread_mutex_unlock(queue->mutex);
+
+    return count;
+}
+
+#ifdef __linux__
+
+static void signal_open(evqueue_s * queue) {
+    queue->descriptor = queue->notifier = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+static void signal_close(evqueue_s * queue) {
+    if (-1 != queue->descriptor) {
+        close(queue->descriptor);
+    }
+}
+
+static void signal_raise(evqueue_s * queue) {
+    const uint64_t increment = 1;
+    const ssize_t written = write(queue->notifier, &increment, sizeof(increment));
+    ASSERT_EVQUE(sizeof(increment) == written && "[ERROR] Failed to signal eventfd.");
+    (void)(written);
+}
+
+static void signal_clear(evqueue_s * queue) {
+    uint64_t counter = 0;
+    const ssize_t received = read(queue->descriptor, &counter, sizeof(counter)); // fails with 'EAGAIN' if not signaled
+    (void)(received);
+}
+
+#else
+
+// without eventfd a non-blocking self-pipe carries a byte per transition while queue is signaled
+static void signal_open(evqueue_s * queue) {
+    int descriptors[2] = { -1, -1, };
+    if (pipe(descriptors)) {
+        return;
+    }
+
+    for (size_t i = 0; i < sizeof(descriptors) / sizeof(descriptors[0]); ++i) {
+        fcntl(descriptors[i], F_SETFL, fcntl(descriptors[i], F_GETFL) | O_NONBLOCK);
+        fcntl(descriptors[i], F_SETFD, fcntl(descriptors[i], F_GETFD) | FD_CLOEXEC);
+    }
+    queue->descriptor = descriptors[0];
+    queue->notifier = descriptors[1];
+}
+
+static void signal_close(evqueue_s * queue) {
+    if (-1 != queue->descriptor) {
+        close(queue->descriptor);
+        close(queue->notifier);
+    }
+}
+
+static void signal_raise(evqueue_s * queue) {
+    const char byte = 0;
+    const ssize_t written = write(queue->notifier, &byte, sizeof(byte));
+    ASSERT_EVQUE(sizeof(byte) == written && "[ERROR] Failed to signal pipe.");
+    (void)(written);
+}
+
+static void signal_clear(evqueue_s * queue) {
+    char bytes[16] = { 0 }; // a late signal may sit behind an earlier one, so drain whatever is buffered
+    while (read(queue->descriptor, bytes, sizeof(bytes)) > 0) {}
+}
+
+#endif
\ No newline at end of file
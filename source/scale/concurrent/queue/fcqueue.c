@@ -0,0 +1,178 @@
+#include <scale/concurrent/queue/fcqueue.h>
+
+#include <stdint.h>
+#include <sched.h>
+
+#ifndef ASSERT_FCQUE
+#   include <assert.h>
+#   define ASSERT_FCQUE assert
+#endif
+
+#if !defined(REALLOC_FCQUE) && !defined(FREE_FCQUE)
+#   include <stdlib.h>
+#   ifndef REALLOC_FCQUE
+#       define REALLOC_FCQUE realloc
+#   endif
+#   ifndef FREE_FCQUE
+#       define FREE_FCQUE free
+#   endif
+#elif !defined(REALLOC_FCQUE)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_FCQUE)
+#   error Free macro is not defined!
+#endif
+
+#ifndef REQUEST_COUNT_FCQUE
+#   define REQUEST_COUNT_FCQUE (1 << 6) // number of publication slots, more concurrent threads wait for a free slot
+#elif REQUEST_COUNT_FCQUE <= 0
+#   error 'REQUEST_COUNT_FCQUE' must be greater than 0
+#endif
+
+#ifndef SPIN_COUNT_FCQUE
+#   define SPIN_COUNT_FCQUE (1 << 6) // number of checks a waiting thread makes before it starts yielding
+#elif SPIN_COUNT_FCQUE < 0
+#   error 'SPIN_COUNT_FCQUE' cannot be less than 0
+#endif
+
+/// States of a publication slot, only the thread that claimed slot sets it back to free.
+enum request_state { REQUEST_FREE, REQUEST_CLAIMED, REQUEST_PENDING, REQUEST_DONE, };
+/// Operations a thread can publish for the combiner.
+enum request_operation { OPERATION_ENQUEUE, OPERATION_PEEK, OPERATION_DEQUEUE, };
+
+struct fcqueue_request {
+    size_t state; // request state, changed with acquire/release so operands and result are published with it
+    enum request_operation operation; // operation to apply on queue
+    void * element; // caller's element to enqueue from or to save into
+    size_t element_size; // size of caller's element
+    bool result; // 'false' if operation found queue empty
+    char padding[CACHE_LINE_FCQUE]; // keeps slots of different threads on separate cache lines
+};
+
+/// @brief Publishes operation, then either waits for the combiner to apply it or becomes the combiner.
+/// @param queue Queue data structure.
+/// @param operation Operation to apply.
+/// @param element Caller's element.
+/// @param element_size Size of a single element.
+/// @return Result of operation.
+static bool publish(fcqueue_s * queue, const enum request_operation operation, void * element, const size_t element_size);
+
+/// @brief Applies every pending request on the underlying queue while holding combiner lock.
+/// @param queue Queue data structure.
+static void combine(fcqueue_s * queue);
+
+fcqueue_s fcque_create(void) {
+    fcqueue_s queue = { .queue = sque_create(), .lock = 0, };
+    queue.requests = REALLOC_FCQUE(NULL, REQUEST_COUNT_FCQUE * sizeof(struct fcqueue_request));
+    ASSERT_FCQUE(queue.requests && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < REQUEST_COUNT_FCQUE; ++i) {
+        queue.requests[i].state = REQUEST_FREE;
+    }
+
+    return queue;
+}
+
+void fcque_destroy(fcqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_FCQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_FCQUE(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_FCQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    sque_destroy(&queue->queue, destroy, element_size);
+    FREE_FCQUE(queue->requests);
+    (*queue) = (fcqueue_s) { 0 };
+}
+
+void fcque_enqueue(fcqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_FCQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_FCQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    // element is only read by combiner, so casting away const never writes into it
+    publish(queue, OPERATION_ENQUEUE, (void*)element, element_size);
+}
+
+bool fcque_peek(fcqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_FCQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_FCQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(queue, OPERATION_PEEK, element, element_size);
+}
+
+bool fcque_dequeue(fcqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_FCQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_FCQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(queue, OPERATION_DEQUEUE, element, element_size);
+}
+
+static bool publish(fcqueue_s * queue, const enum request_operation operation, void * element, const size_t element_size) {
+    // start probing at the slot calling thread claimed last, so threads tend to keep separate slots
+    static __thread size_t slot = 0; // claimed slot's index plus one, zero until seeded; GCC-only like the atomic builtins
+    if (!slot) { // seed from hash of thread-local's address, whose higher bits differ for each thread
+        slot = (size_t)((((uint64_t)(uintptr_t)&slot * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % REQUEST_COUNT_FCQUE) + 1;
+    }
+    size_t index = slot - 1;
+    struct fcqueue_request * request = NULL;
+    for (size_t attempt = 0; !request; ++attempt, index = (index + 1) % REQUEST_COUNT_FCQUE) {
+        size_t expected = REQUEST_FREE;
+        if (__atomic_compare_exchange_n(&queue->requests[index].state, &expected, REQUEST_CLAIMED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            request = &queue->requests[index];
+        } else if (attempt >= REQUEST_COUNT_FCQUE) {
+            sched_yield();
+        }
+    }
+
+    slot = (size_t)(request - queue->requests) + 1;
+
+    request->operation = operation;
+    request->element = element;
+    request->element_size = element_size;
+    __atomic_store_n(&request->state, REQUEST_PENDING, __ATOMIC_RELEASE);
+
+    for (size_t attempt = 0; REQUEST_DONE != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE); ++attempt) {
+        size_t expected = 0;
+        if (!__atomic_load_n(&queue->lock, __ATOMIC_RELAXED) && __atomic_compare_exchange_n(&queue->lock, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            combine(queue);
+            __atomic_store_n(&queue->lock, 0, __ATOMIC_RELEASE);
+        } else if (attempt >= SPIN_COUNT_FCQUE) {
+            sched_yield();
+        }
+    }
+
+    const bool result = request->result;
+    __atomic_store_n(&request->state, REQUEST_FREE, __ATOMIC_RELEASE);
+
+    return result;
+}
+
+static void combine(fcqueue_s * queue) {
+    for (size_t i = 0; i < REQUEST_COUNT_FCQUE; ++i) {
+        struct fcqueue_request * request = &queue->requests[i];
+        if (REQUEST_PENDING != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+
+        request->result = true;
+        switch (request->operation) {
+            case OPERATION_ENQUEUE: {
+                sque_enqueue(&queue->queue, request->element, request->element_size);
+            } break;
+            case OPERATION_PEEK: {
+                request->result = !sque_is_empty(queue->queue);
+                if (request->result) {
+                    sque_peek(queue->queue, request->element, request->element_size);
+                }
+            } break;
+            case OPERATION_DEQUEUE: {
+                request->result = !sque_is_empty(queue->queue);
+                if (request->result) {
+                    sque_dequeue(&queue->queue, request->element, request->element_size);
+                }
+            } break;
+        }
+
+        __atomic_store_n(&request->state, REQUEST_DONE, __ATOMIC_RELEASE);
+    }
+}
\ No newline at end of file
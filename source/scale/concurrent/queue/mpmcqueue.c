@@ -0,0 +1,145 @@
+#include <scale/concurrent/queue/mpmcqueue.h>
+
+#include <string.h>
+#include <stdint.h>
+#include <sched.h>
+
+#ifndef ASSERT_MPMC
+#   include <assert.h>
+#   define ASSERT_MPMC assert
+#endif
+
+#if !defined(REALLOC_MPMC) && !defined(FREE_MPMC)
+#   include <stdlib.h>
+#   ifndef REALLOC_MPMC
+#       define REALLOC_MPMC realloc
+#   endif
+#   ifndef FREE_MPMC
+#       define FREE_MPMC free
+#   endif
+#elif !defined(REALLOC_MPMC)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_MPMC)
+#   error Free macro is not defined!
+#endif
+
+#ifndef SPIN_COUNT_MPMC
+#   define SPIN_COUNT_MPMC (1 << 6) // number of failed attempts before blocking operations start yielding
+#elif SPIN_COUNT_MPMC < 0
+#   error 'SPIN_COUNT_MPMC' cannot be less than 0
+#endif
+
+// Calculates size of a slot, so that each slot's sequence number stays aligned.
+#define SLOT_SIZE_MPMC(element_size) (sizeof(size_t) + ((((element_size) + sizeof(size_t) - 1) / sizeof(size_t)) * sizeof(size_t)))
+
+mpmcqueue_s mpmc_create(const size_t capacity, const size_t element_size) {
+    ASSERT_MPMC(capacity && "[ERROR] Queue's capacity can't be zero.");
+    ASSERT_MPMC(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t power = 2; // a single slot's sequence for next lap equals next free position, so full queue can't be told apart
+    while (power < capacity) {
+        power <<= 1;
+        ASSERT_MPMC(power && "[ERROR] Queue's capacity will overflow.");
+    }
+
+    mpmcqueue_s queue = { .capacity = power, };
+    queue.slots = REALLOC_MPMC(NULL, power * SLOT_SIZE_MPMC(element_size));
+    ASSERT_MPMC(queue.slots && "[ERROR] Memory allocation failed.");
+
+    // each slot starts with sequence equal to its index, which marks it as free for that enqueue position
+    for (size_t i = 0; i < power; ++i) {
+        size_t * sequence = (size_t*)(queue.slots + (i * SLOT_SIZE_MPMC(element_size)));
+        (*sequence) = i;
+    }
+
+    return queue;
+}
+
+void mpmc_destroy(mpmcqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_MPMC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MPMC(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_MPMC(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (size_t i = queue->head; i != queue->tail; ++i) {
+        char * slot = queue->slots + ((i & (queue->capacity - 1)) * SLOT_SIZE_MPMC(element_size));
+        destroy(slot + sizeof(size_t));
+    }
+
+    FREE_MPMC(queue->slots);
+    (*queue) = (mpmcqueue_s) { 0 };
+}
+
+bool mpmc_try_enqueue(mpmcqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_MPMC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MPMC(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MPMC(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t position = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    char * slot = NULL;
+    while (true) {
+        slot = queue->slots + ((position & (queue->capacity - 1)) * SLOT_SIZE_MPMC(element_size));
+        const size_t sequence = __atomic_load_n((size_t*)slot, __ATOMIC_ACQUIRE);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (!difference) { // slot is free for this position, so try to claim position
+            if (__atomic_compare_exchange_n(&queue->tail, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (difference < 0) { // slot still holds element from previous lap, so queue is full
+            return false;
+        } else { // another producer claimed position, so reload it
+            position = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(slot + sizeof(size_t), element, element_size);
+    __atomic_store_n((size_t*)slot, position + 1, __ATOMIC_RELEASE); // publish element to consumer of position
+
+    return true;
+}
+
+bool mpmc_try_dequeue(mpmcqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_MPMC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MPMC(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MPMC(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t position = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    char * slot = NULL;
+    while (true) {
+        slot = queue->slots + ((position & (queue->capacity - 1)) * SLOT_SIZE_MPMC(element_size));
+        const size_t sequence = __atomic_load_n((size_t*)slot, __ATOMIC_ACQUIRE);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+        if (!difference) { // slot holds published element for this position, so try to claim position
+            if (__atomic_compare_exchange_n(&queue->head, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (difference < 0) { // element for this position isn't published yet, so queue is empty
+            return false;
+        } else { // another consumer claimed position, so reload it
+            position = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(element, slot + sizeof(size_t), element_size);
+    // mark slot as free for producer of the same index in the next lap
+    __atomic_store_n((size_t*)slot, position + queue->capacity, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+void mpmc_enqueue(mpmcqueue_s * queue, const void * element, const size_t element_size) {
+    for (size_t attempt = 0; !mpmc_try_enqueue(queue, element, element_size); ++attempt) {
+        if (attempt >= SPIN_COUNT_MPMC) {
+            sched_yield();
+        }
+    }
+}
+
+void mpmc_dequeue(mpmcqueue_s * queue, void * element, const size_t element_size) {
+    for (size_t attempt = 0; !mpmc_try_dequeue(queue, element, element_size); ++attempt) {
+        if (attempt >= SPIN_COUNT_MPMC) {
+            sched_yield();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#define _POSIX_C_SOURCE 199309L // exposes 'clock_gettime' under strict C99
+
+#include <scale/concurrent/queue/mqueue.h>
+#include <scale/sequential/queue/squeue.h>
+
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+
+#ifndef ASSERT_MQUE
+#   include <assert.h>
+#   define ASSERT_MQUE assert
+#endif
+
+#if !defined(REALLOC_MQUE) && !defined(FREE_MQUE)
+#   include <stdlib.h>
+#   ifndef REALLOC_MQUE
+#       define REALLOC_MQUE realloc
+#   endif
+#   ifndef FREE_MQUE
+#       define FREE_MQUE free
+#   endif
+#elif !defined(REALLOC_MQUE)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_MQUE)
+#   error Free macro is not defined!
+#endif
+
+#ifndef CACHE_LINE_MQUE
+#   define CACHE_LINE_MQUE 64 // size of a single cache line in bytes used to separate shards
+#endif
+
+#define EMPTY_MQUE UINT64_MAX // front stamp of an empty shard, so it always loses comparison of fronts
+// Calculates size of an entry in shard's queue, a time stamp followed by element.
+#define ENTRY_SIZE_MQUE(element_size) (sizeof(uint64_t) + (element_size))
+
+struct mqueue_shard {
+    squeue_s queue; // entries of shard, touched only while holding lock
+    char * entry; // scratch entry used to assemble stamp and element while holding lock
+    uint64_t front; // stamp of front entry or 'EMPTY_MQUE', read without lock to pick shards
+    size_t lock; // try-lock, threads that fail to take it move on to another shard
+    char padding[CACHE_LINE_MQUE];
+};
+
+/// @brief Generates pseudo-random number from calling thread's own xorshift state.
+/// @return Pseudo-random number.
+static uint64_t pick(void);
+
+/// @brief Gets current monotonic time.
+/// @return Current time in nanoseconds.
+static uint64_t now(void);
+
+/// @brief Tries to take shard's lock without waiting.
+/// @param shard Shard to lock.
+/// @return 'true' if lock was taken, 'false' otherwise.
+static bool try_lock(struct mqueue_shard * shard);
+
+/// @brief Releases shard's lock.
+/// @param shard Shard to unlock.
+static void unlock(struct mqueue_shard * shard);
+
+/// @brief Dequeues front element of locked shard and publishes stamp of its new front.
+/// @param shard Locked, non-empty shard.
+/// @param element Single element to save dequeued element into.
+/// @param element_size Size of a single element.
+static void shard_dequeue(struct mqueue_shard * shard, void * element, const size_t element_size);
+
+mqueue_s mque_create(const size_t shard_count, const size_t element_size) {
+    ASSERT_MQUE(shard_count && "[ERROR] Shard count can't be zero.");
+    ASSERT_MQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    mqueue_s queue = { .shard_count = shard_count, };
+    queue.shards = REALLOC_MQUE(NULL, shard_count * sizeof(struct mqueue_shard));
+    ASSERT_MQUE(queue.shards && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < shard_count; ++i) {
+        struct mqueue_shard * shard = &queue.shards[i];
+        shard->queue = sque_create();
+        shard->entry = REALLOC_MQUE(NULL, ENTRY_SIZE_MQUE(element_size));
+        ASSERT_MQUE(shard->entry && "[ERROR] Memory allocation failed.");
+        shard->front = EMPTY_MQUE;
+        shard->lock = 0;
+    }
+
+    return queue;
+}
+
+void mque_destroy(mqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_MQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MQUE(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_MQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (size_t i = 0; i < queue->shard_count; ++i) {
+        struct mqueue_shard * shard = &queue->shards[i];
+        while (!sque_is_empty(shard->queue)) {
+            sque_dequeue(&shard->queue, shard->entry, ENTRY_SIZE_MQUE(element_size));
+            destroy(shard->entry + sizeof(uint64_t));
+        }
+        sque_destroy(&shard->queue, destroy, ENTRY_SIZE_MQUE(element_size));
+        FREE_MQUE(shard->entry);
+    }
+
+    FREE_MQUE(queue->shards);
+    (*queue) = (mqueue_s) { 0 };
+}
+
+bool mque_is_empty(mqueue_s const * queue) {
+    ASSERT_MQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    for (size_t i = 0; i < queue->shard_count; ++i) {
+        if (EMPTY_MQUE != __atomic_load_n(&queue->shards[i].front, __ATOMIC_RELAXED)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void mque_enqueue(mqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_MQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t index = (size_t)(pick() % queue->shard_count);
+    for (size_t attempt = 0; !try_lock(&queue->shards[index]); ++attempt, index = (index + 1) % queue->shard_count) {
+        if (attempt >= queue->shard_count) {
+            sched_yield();
+        }
+    }
+
+    // stamp is taken while holding lock, so that stamps in a single shard never decrease
+    const uint64_t stamp = now();
+    struct mqueue_shard * shard = &queue->shards[index];
+    memcpy(shard->entry, &stamp, sizeof(uint64_t));
+    memcpy(shard->entry + sizeof(uint64_t), element, element_size);
+    sque_enqueue(&shard->queue, shard->entry, ENTRY_SIZE_MQUE(element_size));
+    if (1 == shard->queue.size) {
+        __atomic_store_n(&shard->front, stamp, __ATOMIC_RELAXED);
+    }
+
+    unlock(shard);
+}
+
+bool mque_dequeue(mqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_MQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_MQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_MQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (size_t attempt = 0; ; ++attempt) {
+        const uint64_t random = pick();
+        const size_t first = (size_t)((random & UINT32_MAX) % queue->shard_count);
+        const size_t second = (size_t)((random >> 32) % queue->shard_count);
+
+        const uint64_t first_front = __atomic_load_n(&queue->shards[first].front, __ATOMIC_RELAXED);
+        const uint64_t second_front = __atomic_load_n(&queue->shards[second].front, __ATOMIC_RELAXED);
+        size_t index = first_front <= second_front ? first : second;
+
+        if (EMPTY_MQUE == (first_front <= second_front ? first_front : second_front)) {
+            // both picks are empty, so scan for any non-empty shard before reporting queue as empty
+            index = queue->shard_count;
+            for (size_t i = 0; i < queue->shard_count && index == queue->shard_count; ++i) {
+                if (EMPTY_MQUE != __atomic_load_n(&queue->shards[i].front, __ATOMIC_RELAXED)) {
+                    index = i;
+                }
+            }
+            if (index == queue->shard_count) {
+                return false;
+            }
+        }
+
+        struct mqueue_shard * shard = &queue->shards[index];
+        if (try_lock(shard)) {
+            const bool has_element = !sque_is_empty(shard->queue);
+            if (has_element) {
+                shard_dequeue(shard, element, element_size);
+            }
+            unlock(shard);
+
+            if (has_element) {
+                return true;
+            }
+        } else if (attempt >= queue->shard_count) {
+            sched_yield();
+        }
+    }
+}
+
+static uint64_t pick(void) {
+    static __thread uint64_t random = 0; // per-thread xorshift state, GCC-only like the atomic builtins
+    if (!random) { // seed from thread-local's own address, which differs for each thread
+        random = ((uint64_t)(uintptr_t)&random * UINT64_C(0x9E3779B97F4A7C15)) | 1;
+    }
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+
+    return random;
+}
+
+static uint64_t now(void) {
+    struct timespec current;
+    clock_gettime(CLOCK_MONOTONIC, &current);
+    return ((uint64_t)current.tv_sec * 1000000000) + (uint64_t)current.tv_nsec;
+}
+
+static bool try_lock(struct mqueue_shard * shard) {
+    return !__atomic_load_n(&shard->lock, __ATOMIC_RELAXED) && !__atomic_exchange_n(&shard->lock, 1, __ATOMIC_ACQUIRE);
+}
+
+static void unlock(struct mqueue_shard * shard) {
+    __atomic_store_n(&shard->lock, 0, __ATOMIC_RELEASE);
+}
+
+static void shard_dequeue(struct mqueue_shard * shard, void * element, const size_t element_size) {
+    sque_dequeue(&shard->queue, shard->entry, ENTRY_SIZE_MQUE(element_size));
+    memcpy(element, shard->entry + sizeof(uint64_t), element_size);
+
+    uint64_t front = EMPTY_MQUE;
+    if (!sque_is_empty(shard->queue)) {
+        memcpy(&front, sque_at(&shard->queue, 0, ENTRY_SIZE_MQUE(element_size)), sizeof(uint64_t));
+    }
+    __atomic_store_n(&shard->front, front, __ATOMIC_RELAXED);
+}
\ No newline at end of file
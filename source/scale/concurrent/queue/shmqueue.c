@@ -0,0 +1,270 @@
+#define _POSIX_C_SOURCE 200112L // exposes 'shm_open', 'ftruncate' and 'mmap' under strict C99
+
+#include <scale/concurrent/queue/shmqueue.h>
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef ASSERT_SHMQ
+#   include <assert.h>
+#   define ASSERT_SHMQ assert
+#endif
+
+#define MAGIC_SHMQ UINT64_C(0x4E4F524D53484D51) // marks fully initialized segment, spells 'NORMSHMQ'
+
+struct shmqueue_header {
+    uint64_t magic; // equals 'MAGIC_SHMQ' only while segment is fully initialized
+    uint64_t generation; // incremented each time segment is reinitialized
+    uint64_t capacity; // power of two capacity of ring
+    uint64_t element_size; // size of a single element
+    char shared_padding[CACHE_LINE_SHMQ];
+
+    uint64_t tail; // producer's enqueue index
+    char tail_padding[CACHE_LINE_SHMQ];
+
+    uint64_t head; // consumer's dequeue index
+    char head_padding[CACHE_LINE_SHMQ];
+};
+
+// Calculates offset of ring in segment, so that elements start on their own cache line.
+#define RING_OFFSET_SHMQ (((sizeof(struct shmqueue_header) + CACHE_LINE_SHMQ - 1) / CACHE_LINE_SHMQ) * CACHE_LINE_SHMQ)
+
+/// @brief Checks if segment wasn't reinitialized since queue attached, so that stale indexes never touch the new ring.
+static bool is_current(shmqueue_s const * queue) {
+    return MAGIC_SHMQ == __atomic_load_n(&queue->header->magic, __ATOMIC_ACQUIRE)
+        && queue->generation == __atomic_load_n(&queue->header->generation, __ATOMIC_RELAXED);
+}
+
+/// @brief Copies elements into ring starting at index, wrapping around its end.
+static void ring_write(shmqueue_s * queue, const uint64_t index, const char * elements, const size_t n, const size_t element_size) {
+    const size_t start = (size_t)(index & (queue->capacity - 1));
+    const size_t right_size = n < queue->capacity - start ? n : queue->capacity - start;
+
+    memcpy(queue->elements + (start * element_size), elements, right_size * element_size);
+    memcpy(queue->elements, elements + (right_size * element_size), (n - right_size) * element_size);
+}
+
+/// @brief Copies elements out of ring starting at index, wrapping around its end.
+static void ring_read(shmqueue_s const * queue, const uint64_t index, char * elements, const size_t n, const size_t element_size) {
+    const size_t start = (size_t)(index & (queue->capacity - 1));
+    const size_t right_size = n < queue->capacity - start ? n : queue->capacity - start;
+
+    memcpy(elements, queue->elements + (start * element_size), right_size * element_size);
+    memcpy(elements + (right_size * element_size), queue->elements, (n - right_size) * element_size);
+}
+
+shmqueue_s shmq_create(const char * name, const size_t capacity, const size_t element_size) {
+    ASSERT_SHMQ(name && "[ERROR] 'name' parameter is NULL.");
+    ASSERT_SHMQ(capacity && "[ERROR] Queue's capacity can't be zero.");
+    ASSERT_SHMQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t power = 1;
+    while (power < capacity) {
+        power <<= 1;
+        ASSERT_SHMQ(power && "[ERROR] Queue's capacity will overflow.");
+    }
+
+    const int descriptor = shm_open(name, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (-1 == descriptor) {
+        return (shmqueue_s) { 0 };
+    }
+
+    const size_t mapped_size = RING_OFFSET_SHMQ + (power * element_size);
+    struct stat status;
+    void * map = MAP_FAILED;
+    // never resize an existing segment, since shrinking it under other processes' mappings makes their accesses fault
+    if (!fstat(descriptor, &status) && (!status.st_size || (size_t)status.st_size == mapped_size)
+        && (status.st_size || !ftruncate(descriptor, (off_t)mapped_size))) {
+        map = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    }
+    close(descriptor);
+    if (MAP_FAILED == map) {
+        return (shmqueue_s) { 0 };
+    }
+
+    // clear magic first, so that a process attaching during reinitialization sees an uninitialized segment
+    struct shmqueue_header * header = map;
+    __atomic_store_n(&header->magic, 0, __ATOMIC_RELEASE);
+    const uint64_t generation = __atomic_load_n(&header->generation, __ATOMIC_RELAXED) + 1;
+
+    header->capacity = power;
+    header->element_size = element_size;
+    __atomic_store_n(&header->tail, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&header->head, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&header->generation, generation, __ATOMIC_RELAXED);
+    __atomic_store_n(&header->magic, MAGIC_SHMQ, __ATOMIC_RELEASE);
+
+    return (shmqueue_s) {
+        .header = header, .elements = (char*)map + RING_OFFSET_SHMQ, .capacity = power,
+        .mapped_size = mapped_size, .generation = generation,
+    };
+}
+
+shmqueue_s shmq_attach(const char * name, const size_t element_size) {
+    ASSERT_SHMQ(name && "[ERROR] 'name' parameter is NULL.");
+    ASSERT_SHMQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    const int descriptor = shm_open(name, O_RDWR, 0);
+    if (-1 == descriptor) {
+        return (shmqueue_s) { 0 };
+    }
+
+    struct stat status;
+    void * map = MAP_FAILED;
+    if (!fstat(descriptor, &status) && (size_t)status.st_size >= RING_OFFSET_SHMQ) {
+        map = mmap(NULL, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    }
+    close(descriptor);
+    if (MAP_FAILED == map) {
+        return (shmqueue_s) { 0 };
+    }
+
+    const size_t mapped_size = (size_t)status.st_size;
+    struct shmqueue_header * header = map;
+    const bool is_initialized = MAGIC_SHMQ == __atomic_load_n(&header->magic, __ATOMIC_ACQUIRE);
+    if (!is_initialized || header->element_size != element_size || mapped_size < RING_OFFSET_SHMQ + (header->capacity * element_size)) {
+        munmap(map, mapped_size);
+        return (shmqueue_s) { 0 };
+    }
+
+    return (shmqueue_s) {
+        .header = header, .elements = (char*)map + RING_OFFSET_SHMQ, .capacity = (size_t)header->capacity,
+        .mapped_size = mapped_size, .generation = __atomic_load_n(&header->generation, __ATOMIC_RELAXED),
+        .cached_head = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE), .cached_tail = __atomic_load_n(&header->tail, __ATOMIC_ACQUIRE),
+    };
+}
+
+void shmq_detach(shmqueue_s * queue) {
+    ASSERT_SHMQ(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    if (queue->header) {
+        munmap(queue->header, queue->mapped_size);
+    }
+    (*queue) = (shmqueue_s) { 0 };
+}
+
+bool shmq_unlink(const char * name) {
+    ASSERT_SHMQ(name && "[ERROR] 'name' parameter is NULL.");
+
+    return !shm_unlink(name);
+}
+
+bool shmq_is_valid(shmqueue_s const * queue) {
+    ASSERT_SHMQ(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    return queue->header && MAGIC_SHMQ == __atomic_load_n(&queue->header->magic, __ATOMIC_ACQUIRE)
+        && queue->generation == __atomic_load_n(&queue->header->generation, __ATOMIC_RELAXED);
+}
+
+bool shmq_is_full(shmqueue_s const * queue) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+
+    const uint64_t head = __atomic_load_n(&queue->header->head, __ATOMIC_ACQUIRE);
+    const uint64_t tail = __atomic_load_n(&queue->header->tail, __ATOMIC_ACQUIRE);
+    return (tail - head) == queue->capacity;
+}
+
+bool shmq_is_empty(shmqueue_s const * queue) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+
+    const uint64_t tail = __atomic_load_n(&queue->header->tail, __ATOMIC_ACQUIRE);
+    const uint64_t head = __atomic_load_n(&queue->header->head, __ATOMIC_ACQUIRE);
+    return tail == head;
+}
+
+bool shmq_enqueue(shmqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+    ASSERT_SHMQ(element && "[ERROR] 'element' parameter is NULL.");
+    // stale cached indexes would corrupt reinitialized segment's ring, whose element size may differ too
+    if (!is_current(queue)) {
+        return false;
+    }
+    ASSERT_SHMQ(element_size == queue->header->element_size && "[ERROR] Element's size doesn't match queue's.");
+
+    // tail is only written by producer, so it can be read without synchronization
+    const uint64_t tail = __atomic_load_n(&queue->header->tail, __ATOMIC_RELAXED);
+    if (tail - queue->cached_head == queue->capacity) { // refresh consumer's head only when queue seems full
+        queue->cached_head = __atomic_load_n(&queue->header->head, __ATOMIC_ACQUIRE);
+        if (tail - queue->cached_head == queue->capacity) {
+            return false;
+        }
+    }
+
+    memcpy(queue->elements + ((tail & (queue->capacity - 1)) * element_size), element, element_size);
+    __atomic_store_n(&queue->header->tail, tail + 1, __ATOMIC_RELEASE); // publish element to consumer
+
+    return true;
+}
+
+bool shmq_dequeue(shmqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+    ASSERT_SHMQ(element && "[ERROR] 'element' parameter is NULL.");
+    // stale cached indexes would corrupt reinitialized segment's ring, whose element size may differ too
+    if (!is_current(queue)) {
+        return false;
+    }
+    ASSERT_SHMQ(element_size == queue->header->element_size && "[ERROR] Element's size doesn't match queue's.");
+
+    // head is only written by consumer, so it can be read without synchronization
+    const uint64_t head = __atomic_load_n(&queue->header->head, __ATOMIC_RELAXED);
+    if (head == queue->cached_tail) { // refresh producer's tail only when queue seems empty
+        queue->cached_tail = __atomic_load_n(&queue->header->tail, __ATOMIC_ACQUIRE);
+        if (head == queue->cached_tail) {
+            return false;
+        }
+    }
+
+    memcpy(element, queue->elements + ((head & (queue->capacity - 1)) * element_size), element_size);
+    __atomic_store_n(&queue->header->head, head + 1, __ATOMIC_RELEASE); // release element's slot to producer
+
+    return true;
+}
+
+size_t shmq_enqueue_n(shmqueue_s * queue, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+    ASSERT_SHMQ((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    // stale cached indexes would corrupt reinitialized segment's ring, whose element size may differ too
+    if (!is_current(queue)) {
+        return 0;
+    }
+    ASSERT_SHMQ(element_size == queue->header->element_size && "[ERROR] Element's size doesn't match queue's.");
+
+    const uint64_t tail = __atomic_load_n(&queue->header->tail, __ATOMIC_RELAXED);
+    size_t free_size = queue->capacity - (size_t)(tail - queue->cached_head);
+    if (free_size < n) {
+        queue->cached_head = __atomic_load_n(&queue->header->head, __ATOMIC_ACQUIRE);
+        free_size = queue->capacity - (size_t)(tail - queue->cached_head);
+    }
+
+    const size_t count = n < free_size ? n : free_size;
+    ring_write(queue, tail, elements, count, element_size);
+    __atomic_store_n(&queue->header->tail, tail + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+size_t shmq_dequeue_n(shmqueue_s * queue, void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SHMQ(queue && queue->header && "[ERROR] Queue is not attached.");
+    ASSERT_SHMQ((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    // stale cached indexes would corrupt reinitialized segment's ring, whose element size may differ too
+    if (!is_current(queue)) {
+        return 0;
+    }
+    ASSERT_SHMQ(element_size == queue->header->element_size && "[ERROR] Element's size doesn't match queue's.");
+
+    const uint64_t head = __atomic_load_n(&queue->header->head, __ATOMIC_RELAXED);
+    size_t size = (size_t)(queue->cached_tail - head);
+    if (size < n) {
+        queue->cached_tail = __atomic_load_n(&queue->header->tail, __ATOMIC_ACQUIRE);
+        size = (size_t)(queue->cached_tail - head);
+    }
+
+    const size_t count = n < size ? n : size;
+    ring_read(queue, head, elements, count, element_size);
+    __atomic_store_n(&queue->header->head, head + count, __ATOMIC_RELEASE);
+
+    return count;
+}
\ No newline at end of file
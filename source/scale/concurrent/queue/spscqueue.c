@@ -0,0 +1,164 @@
+#include <scale/concurrent/queue/spscqueue.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SPSC
+#   include <assert.h>
+#   define ASSERT_SPSC assert
+#endif
+
+#if !defined(REALLOC_SPSC) && !defined(FREE_SPSC)
+#   include <stdlib.h>
+#   ifndef REALLOC_SPSC
+#       define REALLOC_SPSC realloc
+#   endif
+#   ifndef FREE_SPSC
+#       define FREE_SPSC free
+#   endif
+#elif !defined(REALLOC_SPSC)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SPSC)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Copies elements into ring array starting at index, wrapping around its end.
+static void ring_write(spscqueue_s * queue, const size_t index, const char * elements, const size_t n, const size_t element_size) {
+    const size_t start = index & (queue->capacity - 1);
+    const size_t right_size = n < queue->capacity - start ? n : queue->capacity - start;
+
+    memcpy((char*)queue->elements + (start * element_size), elements, right_size * element_size);
+    memcpy(queue->elements, elements + (right_size * element_size), (n - right_size) * element_size);
+}
+
+/// @brief Copies elements out of ring array starting at index, wrapping around its end.
+static void ring_read(spscqueue_s const * queue, const size_t index, char * elements, const size_t n, const size_t element_size) {
+    const size_t start = index & (queue->capacity - 1);
+    const size_t right_size = n < queue->capacity - start ? n : queue->capacity - start;
+
+    memcpy(elements, (char*)queue->elements + (start * element_size), right_size * element_size);
+    memcpy(elements + (right_size * element_size), queue->elements, (n - right_size) * element_size);
+}
+
+spscqueue_s spsc_create(const size_t capacity, const size_t element_size) {
+    ASSERT_SPSC(capacity && "[ERROR] Queue's capacity can't be zero.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    size_t power = 1;
+    while (power < capacity) {
+        power <<= 1;
+        ASSERT_SPSC(power && "[ERROR] Queue's capacity will overflow.");
+    }
+
+    spscqueue_s queue = { .capacity = power, };
+    queue.elements = REALLOC_SPSC(NULL, power * element_size);
+    ASSERT_SPSC(queue.elements && "[ERROR] Memory allocation failed.");
+
+    return queue;
+}
+
+void spsc_destroy(spscqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SPSC(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (size_t i = queue->head; i != queue->tail; ++i) {
+        destroy((char*)queue->elements + ((i & (queue->capacity - 1)) * element_size));
+    }
+
+    FREE_SPSC(queue->elements);
+    (*queue) = (spscqueue_s) { 0 };
+}
+
+bool spsc_is_full(spscqueue_s const * queue) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    const size_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    const size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+    return (tail - head) == queue->capacity;
+}
+
+bool spsc_is_empty(spscqueue_s const * queue) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+
+    const size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+    const size_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    return tail == head;
+}
+
+bool spsc_enqueue(spscqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SPSC(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    // tail is only written by producer, so it can be read without synchronization
+    const size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    if (tail - queue->cached_head == queue->capacity) { // refresh consumer's head only when queue seems full
+        queue->cached_head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+        if (tail - queue->cached_head == queue->capacity) {
+            return false;
+        }
+    }
+
+    memcpy((char*)queue->elements + ((tail & (queue->capacity - 1)) * element_size), element, element_size);
+    __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE); // publish element to consumer
+
+    return true;
+}
+
+bool spsc_dequeue(spscqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SPSC(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    // head is only written by consumer, so it can be read without synchronization
+    const size_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    if (head == queue->cached_tail) { // refresh producer's tail only when queue seems empty
+        queue->cached_tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        if (head == queue->cached_tail) {
+            return false;
+        }
+    }
+
+    memcpy(element, (char*)queue->elements + ((head & (queue->capacity - 1)) * element_size), element_size);
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE); // release element's slot to producer
+
+    return true;
+}
+
+size_t spsc_enqueue_n(spscqueue_s * queue, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SPSC((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    size_t free_size = queue->capacity - (tail - queue->cached_head);
+    if (free_size < n) {
+        queue->cached_head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+        free_size = queue->capacity - (tail - queue->cached_head);
+    }
+
+    const size_t count = n < free_size ? n : free_size;
+    ring_write(queue, tail, elements, count, element_size);
+    __atomic_store_n(&queue->tail, tail + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+size_t spsc_dequeue_n(spscqueue_s * queue, void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SPSC(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SPSC((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SPSC(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    size_t size = queue->cached_tail - head;
+    if (size < n) {
+        queue->cached_tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        size = queue->cached_tail - head;
+    }
+
+    const size_t count = n < size ? n : size;
+    ring_read(queue, head, elements, count, element_size);
+    __atomic_store_n(&queue->head, head + count, __ATOMIC_RELEASE);
+
+    return count;
+}
\ No newline at end of file
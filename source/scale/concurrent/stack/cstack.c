@@ -0,0 +1,299 @@
+#include <scale/concurrent/stack/cstack.h>
+
+#include <string.h>
+#include <sched.h>
+
+#ifndef ASSERT_CSTK
+#   include <assert.h>
+#   define ASSERT_CSTK assert
+#endif
+
+#if !defined(REALLOC_CSTK) && !defined(FREE_CSTK)
+#   include <stdlib.h>
+#   ifndef REALLOC_CSTK
+#       define REALLOC_CSTK realloc
+#   endif
+#   ifndef FREE_CSTK
+#       define FREE_CSTK free
+#   endif
+#elif !defined(REALLOC_CSTK)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_CSTK)
+#   error Free macro is not defined!
+#endif
+
+#ifndef ELIMINATION_SIZE_CSTK
+#   define ELIMINATION_SIZE_CSTK (1 << 3) // number of slots where concurrent push and pop can cancel out
+#elif ELIMINATION_SIZE_CSTK <= 0
+#   error 'ELIMINATION_SIZE_CSTK' must be greater than 0
+#endif
+
+#ifndef SPIN_COUNT_CSTK
+#   define SPIN_COUNT_CSTK (1 << 6) // number of checks a push waits in elimination slot for a matching pop
+#elif SPIN_COUNT_CSTK < 0
+#   error 'SPIN_COUNT_CSTK' cannot be less than 0
+#endif
+
+// Index marking the end of a node list.
+#define NIL_CSTK UINT32_MAX
+// Extracts node index from tagged list head.
+#define INDEX_CSTK(tagged) ((uint32_t)((tagged) & UINT32_MAX))
+// Creates new tagged list head with index and incremented tag, so that a recycled node never matches old head.
+#define RETAG_CSTK(tagged, index) (((((tagged) >> 32) + 1) << 32) | (uint64_t)(index))
+// Calculates size of a node or exchange slot, so that each header stays aligned.
+#define NODE_SIZE_CSTK(element_size) (sizeof(uint64_t) + ((((element_size) + sizeof(uint64_t) - 1) / sizeof(uint64_t)) * sizeof(uint64_t)))
+// Calculates size of an exchange slot, so that each slot occupies separate cache lines.
+#define EXCHANGE_SIZE_CSTK(element_size) (((NODE_SIZE_CSTK(element_size) + CACHE_LINE_CSTK - 1) / CACHE_LINE_CSTK) * CACHE_LINE_CSTK)
+
+/// States of an elimination exchange slot, only the pushing thread that claimed slot sets it back to empty.
+enum exchange_state { EXCHANGE_EMPTY, EXCHANGE_WRITING, EXCHANGE_OFFER, EXCHANGE_READING, EXCHANGE_TAKEN, };
+
+/// @brief Gets node at index.
+/// @param stack Stack data structure.
+/// @param index Index of node.
+/// @param element_size Size of a single element.
+/// @return Pointer to node's next index, element follows it.
+static uint64_t * node_at(cstack_s const * stack, const uint32_t index, const size_t element_size);
+
+/// @brief Pops first node from tagged node list.
+/// @param stack Stack data structure.
+/// @param list Tagged list head.
+/// @param element_size Size of a single element.
+/// @return Index of poped node or 'NIL_CSTK' if list is empty.
+static uint32_t list_pop(cstack_s * stack, uint64_t * list, const size_t element_size);
+
+/// @brief Pushes node to the front of tagged node list.
+/// @param stack Stack data structure.
+/// @param list Tagged list head.
+/// @param index Index of pushed node.
+/// @param element_size Size of a single element.
+static void list_push(cstack_s * stack, uint64_t * list, const uint32_t index, const size_t element_size);
+
+/// @brief Picks random elimination slot on each attempt, so that any pusher and popper backing off can meet.
+/// @param stack Stack data structure.
+/// @param element_size Size of a single element.
+/// @return Pointer to slot's exchange state, element follows it.
+static uint64_t * exchange_pick(cstack_s * stack, const size_t element_size);
+
+/// @brief Offers element in elimination slot and waits shortly for a concurrent pop to take it.
+/// @param stack Stack data structure.
+/// @param element Single element to offer.
+/// @param element_size Size of a single element.
+/// @return 'true' if pop took element, 'false' if offer was withdrawn.
+static bool exchange_push(cstack_s * stack, const void * element, const size_t element_size);
+
+/// @brief Takes element offered by a concurrent push in elimination slot.
+/// @param stack Stack data structure.
+/// @param element Single element to save taken element into.
+/// @param element_size Size of a single element.
+/// @return 'true' if element was taken, 'false' if slot had no offer.
+static bool exchange_pop(cstack_s * stack, void * element, const size_t element_size);
+
+cstack_s cstk_create(const size_t capacity, const size_t element_size) {
+    ASSERT_CSTK(capacity && "[ERROR] Stack's capacity can't be zero.");
+    ASSERT_CSTK(capacity < NIL_CSTK && "[ERROR] Stack's capacity is too large.");
+    ASSERT_CSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    cstack_s stack = { .capacity = capacity, .top = NIL_CSTK, .free = 0, };
+    stack.nodes = REALLOC_CSTK(NULL, capacity * NODE_SIZE_CSTK(element_size));
+    ASSERT_CSTK(stack.nodes && "[ERROR] Memory allocation failed.");
+    stack.exchanges = REALLOC_CSTK(NULL, ELIMINATION_SIZE_CSTK * EXCHANGE_SIZE_CSTK(element_size));
+    ASSERT_CSTK(stack.exchanges && "[ERROR] Memory allocation failed.");
+
+    // every node starts in free list, linked in order of their index
+    for (uint32_t i = 0; i < capacity; ++i) {
+        (*node_at(&stack, i, element_size)) = (i + 1 == capacity) ? NIL_CSTK : i + 1;
+    }
+
+    for (size_t i = 0; i < ELIMINATION_SIZE_CSTK; ++i) {
+        uint64_t * state = (uint64_t*)(stack.exchanges + (i * EXCHANGE_SIZE_CSTK(element_size)));
+        (*state) = EXCHANGE_EMPTY;
+    }
+
+    return stack;
+}
+
+void cstk_destroy(cstack_s * stack, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_CSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_CSTK(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_CSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (uint32_t i = INDEX_CSTK(stack->top); i != NIL_CSTK;) {
+        uint64_t * node = node_at(stack, i, element_size);
+        destroy(node + 1);
+        i = (uint32_t)(*node);
+    }
+
+    FREE_CSTK(stack->nodes);
+    FREE_CSTK(stack->exchanges);
+    (*stack) = (cstack_s) { 0 };
+}
+
+bool cstk_is_empty(cstack_s const * stack) {
+    ASSERT_CSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+
+    return INDEX_CSTK(__atomic_load_n(&stack->top, __ATOMIC_RELAXED)) == NIL_CSTK;
+}
+
+bool cstk_push(cstack_s * stack, const void * element, const size_t element_size) {
+    ASSERT_CSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_CSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    const uint32_t index = list_pop(stack, &stack->free, element_size);
+    if (NIL_CSTK == index) {
+        return false;
+    }
+
+    uint64_t * node = node_at(stack, index, element_size);
+    memcpy(node + 1, element, element_size);
+
+    uint64_t top = __atomic_load_n(&stack->top, __ATOMIC_RELAXED);
+    while (true) {
+        __atomic_store_n(node, INDEX_CSTK(top), __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(&stack->top, &top, RETAG_CSTK(top, index), false, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            return true;
+        }
+
+        // top is contended, so try to hand element to a concurrent pop instead of retrying right away
+        if (exchange_push(stack, element, element_size)) {
+            list_push(stack, &stack->free, index, element_size);
+            return true;
+        }
+        top = __atomic_load_n(&stack->top, __ATOMIC_RELAXED);
+    }
+}
+
+bool cstk_peep(cstack_s const * stack, void * element, const size_t element_size) {
+    ASSERT_CSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_CSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    uint64_t top = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+    while (true) {
+        if (NIL_CSTK == INDEX_CSTK(top)) {
+            return false;
+        }
+
+        // copy may race with a pop and push reusing the node, but the tag changes then and copy is retried
+        memcpy(element, node_at(stack, INDEX_CSTK(top), element_size) + 1, element_size);
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        const uint64_t check = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+        if (check == top) {
+            return true;
+        }
+        top = check;
+    }
+}
+
+bool cstk_pop(cstack_s * stack, void * element, const size_t element_size) {
+    ASSERT_CSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_CSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_CSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    uint64_t top = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+    while (true) {
+        const uint32_t index = INDEX_CSTK(top);
+        if (NIL_CSTK == index) {
+            return false;
+        }
+
+        uint64_t * node = node_at(stack, index, element_size);
+        const uint32_t next = (uint32_t)__atomic_load_n(node, __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(&stack->top, &top, RETAG_CSTK(top, next), false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            memcpy(element, node + 1, element_size);
+            list_push(stack, &stack->free, index, element_size);
+            return true;
+        }
+
+        // top is contended, so try to take element from a concurrent push instead of retrying right away
+        if (exchange_pop(stack, element, element_size)) {
+            return true;
+        }
+        top = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+    }
+}
+
+static uint64_t * node_at(cstack_s const * stack, const uint32_t index, const size_t element_size) {
+    return (uint64_t*)(stack->nodes + ((size_t)index * NODE_SIZE_CSTK(element_size)));
+}
+
+static uint32_t list_pop(cstack_s * stack, uint64_t * list, const size_t element_size) {
+    uint64_t head = __atomic_load_n(list, __ATOMIC_ACQUIRE);
+    while (NIL_CSTK != INDEX_CSTK(head)) {
+        // node may be reused by another thread right after loading head, but its tag then makes the exchange fail
+        const uint32_t next = (uint32_t)__atomic_load_n(node_at(stack, INDEX_CSTK(head), element_size), __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(list, &head, RETAG_CSTK(head, next), false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            return INDEX_CSTK(head);
+        }
+    }
+
+    return NIL_CSTK;
+}
+
+static void list_push(cstack_s * stack, uint64_t * list, const uint32_t index, const size_t element_size) {
+    uint64_t * node = node_at(stack, index, element_size);
+    uint64_t head = __atomic_load_n(list, __ATOMIC_RELAXED);
+    do {
+        __atomic_store_n(node, INDEX_CSTK(head), __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(list, &head, RETAG_CSTK(head, index), false, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static uint64_t * exchange_pick(cstack_s * stack, const size_t element_size) {
+    static __thread uint64_t random = 0; // per-thread xorshift state, GCC-only like the atomic builtins
+    if (!random) { // seed from thread-local's own address, which differs for each thread
+        random = ((uint64_t)(uintptr_t)&random * UINT64_C(0x9E3779B97F4A7C15)) | 1;
+    }
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+
+    return (uint64_t*)(stack->exchanges + ((random % ELIMINATION_SIZE_CSTK) * EXCHANGE_SIZE_CSTK(element_size)));
+}
+
+static bool exchange_push(cstack_s * stack, const void * element, const size_t element_size) {
+    uint64_t * state = exchange_pick(stack, element_size);
+
+    uint64_t expected = EXCHANGE_EMPTY;
+    if (!__atomic_compare_exchange_n(state, &expected, EXCHANGE_WRITING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return false;
+    }
+
+    memcpy(state + 1, element, element_size);
+    __atomic_store_n(state, EXCHANGE_OFFER, __ATOMIC_RELEASE);
+
+    for (size_t i = 0; i < SPIN_COUNT_CSTK; ++i) {
+        if (EXCHANGE_TAKEN == __atomic_load_n(state, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(state, EXCHANGE_EMPTY, __ATOMIC_RELEASE);
+            return true;
+        }
+    }
+
+    expected = EXCHANGE_OFFER;
+    if (__atomic_compare_exchange_n(state, &expected, EXCHANGE_EMPTY, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        return false;
+    }
+
+    // a pop claimed offer just before it was withdrawn, so wait until it finishes copying element
+    while (EXCHANGE_TAKEN != __atomic_load_n(state, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+    __atomic_store_n(state, EXCHANGE_EMPTY, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static bool exchange_pop(cstack_s * stack, void * element, const size_t element_size) {
+    uint64_t * state = exchange_pick(stack, element_size);
+
+    uint64_t expected = EXCHANGE_OFFER;
+    if (!__atomic_compare_exchange_n(state, &expected, EXCHANGE_READING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return false;
+    }
+
+    memcpy(element, state + 1, element_size);
+    __atomic_store_n(state, EXCHANGE_TAKEN, __ATOMIC_RELEASE);
+
+    return true;
+}
\ No newline at end of file
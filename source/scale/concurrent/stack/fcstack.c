@@ -0,0 +1,178 @@
+#include <scale/concurrent/stack/fcstack.h>
+
+#include <stdint.h>
+#include <sched.h>
+
+#ifndef ASSERT_FCSTK
+#   include <assert.h>
+#   define ASSERT_FCSTK assert
+#endif
+
+#if !defined(REALLOC_FCSTK) && !defined(FREE_FCSTK)
+#   include <stdlib.h>
+#   ifndef REALLOC_FCSTK
+#       define REALLOC_FCSTK realloc
+#   endif
+#   ifndef FREE_FCSTK
+#       define FREE_FCSTK free
+#   endif
+#elif !defined(REALLOC_FCSTK)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_FCSTK)
+#   error Free macro is not defined!
+#endif
+
+#ifndef REQUEST_COUNT_FCSTK
+#   define REQUEST_COUNT_FCSTK (1 << 6) // number of publication slots, more concurrent threads wait for a free slot
+#elif REQUEST_COUNT_FCSTK <= 0
+#   error 'REQUEST_COUNT_FCSTK' must be greater than 0
+#endif
+
+#ifndef SPIN_COUNT_FCSTK
+#   define SPIN_COUNT_FCSTK (1 << 6) // number of checks a waiting thread makes before it starts yielding
+#elif SPIN_COUNT_FCSTK < 0
+#   error 'SPIN_COUNT_FCSTK' cannot be less than 0
+#endif
+
+/// States of a publication slot, only the thread that claimed slot sets it back to free.
+enum request_state { REQUEST_FREE, REQUEST_CLAIMED, REQUEST_PENDING, REQUEST_DONE, };
+/// Operations a thread can publish for the combiner.
+enum request_operation { OPERATION_PUSH, OPERATION_PEEP, OPERATION_POP, };
+
+struct fcstack_request {
+    size_t state; // request state, changed with acquire/release so operands and result are published with it
+    enum request_operation operation; // operation to apply on stack
+    void * element; // caller's element to push from or to save into
+    size_t element_size; // size of caller's element
+    bool result; // 'false' if operation found stack empty
+    char padding[CACHE_LINE_FCSTK]; // keeps slots of different threads on separate cache lines
+};
+
+/// @brief Publishes operation, then either waits for the combiner to apply it or becomes the combiner.
+/// @param stack Stack data structure.
+/// @param operation Operation to apply.
+/// @param element Caller's element.
+/// @param element_size Size of a single element.
+/// @return Result of operation.
+static bool publish(fcstack_s * stack, const enum request_operation operation, void * element, const size_t element_size);
+
+/// @brief Applies every pending request on the underlying stack while holding combiner lock.
+/// @param stack Stack data structure.
+static void combine(fcstack_s * stack);
+
+fcstack_s fcstk_create(void) {
+    fcstack_s stack = { .stack = sstk_create(), .lock = 0, };
+    stack.requests = REALLOC_FCSTK(NULL, REQUEST_COUNT_FCSTK * sizeof(struct fcstack_request));
+    ASSERT_FCSTK(stack.requests && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < REQUEST_COUNT_FCSTK; ++i) {
+        stack.requests[i].state = REQUEST_FREE;
+    }
+
+    return stack;
+}
+
+void fcstk_destroy(fcstack_s * stack, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_FCSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_FCSTK(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_FCSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_destroy(&stack->stack, destroy, element_size);
+    FREE_FCSTK(stack->requests);
+    (*stack) = (fcstack_s) { 0 };
+}
+
+void fcstk_push(fcstack_s * stack, const void * element, const size_t element_size) {
+    ASSERT_FCSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_FCSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    // element is only read by combiner, so casting away const never writes into it
+    publish(stack, OPERATION_PUSH, (void*)element, element_size);
+}
+
+bool fcstk_peep(fcstack_s * stack, void * element, const size_t element_size) {
+    ASSERT_FCSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_FCSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(stack, OPERATION_PEEP, element, element_size);
+}
+
+bool fcstk_pop(fcstack_s * stack, void * element, const size_t element_size) {
+    ASSERT_FCSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_FCSTK(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_FCSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    return publish(stack, OPERATION_POP, element, element_size);
+}
+
+static bool publish(fcstack_s * stack, const enum request_operation operation, void * element, const size_t element_size) {
+    // start probing at the slot calling thread claimed last, so threads tend to keep separate slots
+    static __thread size_t slot = 0; // claimed slot's index plus one, zero until seeded; GCC-only like the atomic builtins
+    if (!slot) { // seed from hash of thread-local's address, whose higher bits differ for each thread
+        slot = (size_t)((((uint64_t)(uintptr_t)&slot * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % REQUEST_COUNT_FCSTK) + 1;
+    }
+    size_t index = slot - 1;
+    struct fcstack_request * request = NULL;
+    for (size_t attempt = 0; !request; ++attempt, index = (index + 1) % REQUEST_COUNT_FCSTK) {
+        size_t expected = REQUEST_FREE;
+        if (__atomic_compare_exchange_n(&stack->requests[index].state, &expected, REQUEST_CLAIMED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            request = &stack->requests[index];
+        } else if (attempt >= REQUEST_COUNT_FCSTK) {
+            sched_yield();
+        }
+    }
+
+    slot = (size_t)(request - stack->requests) + 1;
+
+    request->operation = operation;
+    request->element = element;
+    request->element_size = element_size;
+    __atomic_store_n(&request->state, REQUEST_PENDING, __ATOMIC_RELEASE);
+
+    for (size_t attempt = 0; REQUEST_DONE != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE); ++attempt) {
+        size_t expected = 0;
+        if (!__atomic_load_n(&stack->lock, __ATOMIC_RELAXED) && __atomic_compare_exchange_n(&stack->lock, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            combine(stack);
+            __atomic_store_n(&stack->lock, 0, __ATOMIC_RELEASE);
+        } else if (attempt >= SPIN_COUNT_FCSTK) {
+            sched_yield();
+        }
+    }
+
+    const bool result = request->result;
+    __atomic_store_n(&request->state, REQUEST_FREE, __ATOMIC_RELEASE);
+
+    return result;
+}
+
+static void combine(fcstack_s * stack) {
+    for (size_t i = 0; i < REQUEST_COUNT_FCSTK; ++i) {
+        struct fcstack_request * request = &stack->requests[i];
+        if (REQUEST_PENDING != __atomic_load_n(&request->state, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+
+        request->result = true;
+        switch (request->operation) {
+            case OPERATION_PUSH: {
+                sstk_push(&stack->stack, request->element, request->element_size);
+            } break;
+            case OPERATION_PEEP: {
+                request->result = !sstk_is_empty(stack->stack);
+                if (request->result) {
+                    sstk_peep(stack->stack, request->element, request->element_size);
+                }
+            } break;
+            case OPERATION_POP: {
+                request->result = !sstk_is_empty(stack->stack);
+                if (request->result) {
+                    sstk_pop(&stack->stack, request->element, request->element_size);
+                }
+            } break;
+        }
+
+        __atomic_store_n(&request->state, REQUEST_DONE, __ATOMIC_RELEASE);
+    }
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <scale/sequential/deque/sdeque.h>
+#include "../parallel.h"
 
 #include <string.h>
 
@@ -35,6 +36,42 @@
 #   error Expand capacity size is not defined.
 #endif
 
+/// @brief Reverses order of elements in array by swapping them byte by byte, without temporary memory.
+/// @param elements Array of elements.
+/// @param n Number of elements in array.
+/// @param element_size Size of a single element.
+static void reverse_elements(void * elements, const size_t n, const size_t element_size) {
+    if (n < 2) {
+        return;
+    }
+
+    char * left = elements;
+    char * right = (char*)elements + ((n - 1) * element_size);
+    while (left < right) {
+        for (size_t i = 0; i < element_size; ++i) {
+            const char temporary = left[i];
+            left[i] = right[i];
+            right[i] = temporary;
+        }
+        left += element_size;
+        right -= element_size;
+    }
+}
+
+/// @brief Rotates deque's array in place if its elements wrap around the array's end, so they become contiguous.
+/// @param deque Deque data structure.
+/// @param element_size Size of a single element.
+static void linearize(sdeque_s * deque, const size_t element_size) {
+    if ((deque->current + deque->size) <= deque->capacity) {
+        return;
+    }
+
+    reverse_elements(deque->elements, deque->current, element_size);
+    reverse_elements((char*)deque->elements + (deque->current * element_size), deque->capacity - deque->current, element_size);
+    reverse_elements(deque->elements, deque->capacity, element_size);
+    deque->current = 0;
+}
+
 sdeque_s sdeq_create(void) {
     return (sdeque_s) { 0 };
 }
@@ -225,7 +262,7 @@ void sdeq_dequeue_rear(sdeque_s * deque, void * element, const size_t element_si
     ASSERT_SDEQ(element_size && "[ERROR] Element's size can't be zero.");
 
     memcpy(element, (char*)deque->elements + (deque->current * element_size), element_size);
-    deque->capacity++;
+    deque->current++;
     deque->size--;
     if (deque->capacity == deque->current) {
         deque->current = 0;
@@ -255,6 +292,25 @@ void sdeq_dequeue_rear(sdeque_s * deque, void * element, const size_t element_si
     }
 }
 
+void * sdeq_at(sdeque_s const * deque, const size_t index, const size_t element_size) {
+    ASSERT_SDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SDEQ(index < deque->size && "[ERROR] Index out of deque's bounds.");
+    ASSERT_SDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t real_index = (deque->current + index) % deque->capacity;
+    return (char*)deque->elements + (real_index * element_size);
+}
+
+void sdeq_set(sdeque_s * deque, const size_t index, const void * element, const size_t element_size) {
+    ASSERT_SDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SDEQ(index < deque->size && "[ERROR] Index out of deque's bounds.");
+    ASSERT_SDEQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SDEQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t real_index = (deque->current + index) % deque->capacity;
+    memcpy((char*)deque->elements + (real_index * element_size), element, element_size);
+}
+
 void sdeq_foreach(sdeque_s const * deque, const operate_fn operate, const size_t element_size, void * arguments) {
     ASSERT_SDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
     ASSERT_SDEQ(operate && "[ERROR] 'operate' parameter is NULL.");
@@ -272,26 +328,26 @@ void sdeq_foreach(sdeque_s const * deque, const operate_fn operate, const size_t
     }
 }
 
-void sdeq_map(sdeque_s const * deque, const manage_fn manage, const size_t element_size, void * arguments) {
+void sdeq_map(sdeque_s * deque, const manage_fn manage, const size_t element_size, void * arguments) {
     ASSERT_SDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
     ASSERT_SDEQ(manage && "[ERROR] 'manage' parameter is NULL.");
     ASSERT_SDEQ(element_size && "[ERROR] Element's size can't be zero.");
 
-    // create temporary array to have elements in order
-    void * elements_array = REALLOC_SDEQ(NULL, deque->size * element_size);
-    ASSERT_SDEQ((!(deque->size) || elements_array) && "[ERROR] Memory allocation failed.");
-
-    // copy deque's elements into temporary array
-    char * elements = (char*)deque->elements + (deque->current * element_size);
-    const size_t right_size = (deque->current + deque->size) > deque->capacity ? deque->capacity - deque->current : deque->size;
-    memcpy(elements_array, elements, right_size * element_size);
-    memcpy((char*)elements_array + (right_size * element_size), deque->elements, deque->size - right_size);
+    linearize(deque, element_size);
+    manage((char*)deque->elements + (deque->current * element_size), deque->size, element_size, arguments);
+}
 
-    manage(elements_array, deque->size, element_size, arguments);
+void sdeq_map_parallel(sdeque_s * deque, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments) {
+    ASSERT_SDEQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SDEQ(manage && "[ERROR] 'manage' parameter is NULL.");
+    ASSERT_SDEQ(thread_count && "[ERROR] Thread count can't be zero.");
+    ASSERT_SDEQ(element_size && "[ERROR] Element's size can't be zero.");
 
-    // copy managed elements back into deque
-    memcpy(elements, elements_array, right_size * element_size);
-    memcpy(deque->elements, (char*)elements_array + (right_size * element_size), deque->size - right_size);
+    linearize(deque, element_size);
+    const size_t scratch_size = parallel_map_scratch(deque->size, thread_count);
+    void * scratch = scratch_size ? REALLOC_SDEQ(NULL, scratch_size) : NULL;
+    ASSERT_SDEQ((scratch || !scratch_size) && "[ERROR] Memory allocation failed.");
 
-    FREE_SDEQ(elements_array);
+    parallel_map((char*)deque->elements + (deque->current * element_size), deque->size, manage, merge, thread_count, element_size, arguments, scratch);
+    FREE_SDEQ(scratch);
 }
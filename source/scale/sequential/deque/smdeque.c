@@ -0,0 +1,133 @@
+#include <scale/sequential/deque/smdeque.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SMDQ
+#   include <assert.h>
+#   define ASSERT_SMDQ assert
+#endif
+
+#if !defined(REALLOC_SMDQ) && !defined(FREE_SMDQ)
+#   include <stdlib.h>
+#   ifndef REALLOC_SMDQ
+#       define REALLOC_SMDQ realloc
+#   endif
+#   ifndef FREE_SMDQ
+#       define FREE_SMDQ free
+#   endif
+#elif !defined(REALLOC_SMDQ)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SMDQ)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Dequeues candidates from the front whose positions slid out of window ending before 'position'.
+/// @param deque Monotonic deque data structure.
+/// @param position Position of element about to be pushed.
+/// @param element_size Size of a single element.
+static void evict(smdeque_s * deque, const size_t position, const size_t element_size);
+
+/// @brief Leaves position as is, since positions are plain indexes with nothing to destroy.
+/// @param position Single position.
+static void destroy_position(void * position);
+
+/// @brief Dequeues candidates from the rear that are not smaller than element, then enqueues element.
+/// @param deque Monotonic deque data structure.
+/// @param element Single element to push.
+/// @param position Position of element.
+/// @param element_size Size of a single element.
+static void insert(smdeque_s * deque, const void * element, const size_t position, const size_t element_size);
+
+smdeque_s smdq_create(const size_t window, const compare_fn compare, const size_t element_size) {
+    ASSERT_SMDQ(window && "[ERROR] Window can't be zero.");
+    ASSERT_SMDQ(compare && "[ERROR] 'compare' parameter is NULL.");
+    ASSERT_SMDQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    void * scratch = REALLOC_SMDQ(NULL, element_size);
+    ASSERT_SMDQ(scratch && "[ERROR] Memory allocation failed.");
+
+    return (smdeque_s) {
+        .elements = sdeq_create(), .positions = sdeq_create(), .scratch = scratch,
+        .compare = compare, .window = window, .pushed = 0,
+    };
+}
+
+void smdq_destroy(smdeque_s * deque, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SMDQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SMDQ(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SMDQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    sdeq_destroy(&deque->elements, destroy, element_size);
+    sdeq_destroy(&deque->positions, destroy_position, sizeof(size_t));
+    FREE_SMDQ(deque->scratch);
+    (*deque) = (smdeque_s) { 0 };
+}
+
+bool smdq_is_empty(const smdeque_s deque) {
+    return sdeq_is_empty(deque.elements);
+}
+
+void smdq_push(smdeque_s * deque, const void * element, const size_t element_size) {
+    ASSERT_SMDQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SMDQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SMDQ(element_size && "[ERROR] Element's size can't be zero.");
+    ASSERT_SMDQ((~deque->pushed) && "[ERROR] Position variable will overflow.");
+
+    evict(deque, deque->pushed, element_size);
+    insert(deque, element, deque->pushed, element_size);
+    deque->pushed++;
+}
+
+void smdq_push_n(smdeque_s * deque, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SMDQ(deque && "[ERROR] 'deque' parameter is NULL.");
+    ASSERT_SMDQ((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SMDQ(element_size && "[ERROR] Element's size can't be zero.");
+    ASSERT_SMDQ(n <= ~deque->pushed && "[ERROR] Position variable will overflow.");
+
+    // elements before last window's worth slide out before array ends, so they never become candidates
+    const size_t skip = n > deque->window ? n - deque->window : 0;
+    deque->pushed += skip;
+
+    for (size_t i = skip; i < n; ++i) {
+        evict(deque, deque->pushed, element_size);
+        insert(deque, (char const*)elements + (i * element_size), deque->pushed, element_size);
+        deque->pushed++;
+    }
+}
+
+void smdq_peek(const smdeque_s deque, void * element, const size_t element_size) {
+    ASSERT_SMDQ(!sdeq_is_empty(deque.elements) && "[ERROR] Window is empty.");
+    ASSERT_SMDQ(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SMDQ(element_size && "[ERROR] Element's size can't be zero.");
+
+    sdeq_peek_front(deque.elements, element, element_size);
+}
+
+static void evict(smdeque_s * deque, const size_t position, const size_t element_size) {
+    size_t front = 0;
+    while (!sdeq_is_empty(deque->positions)) {
+        sdeq_peek_front(deque->positions, &front, sizeof(size_t));
+        if (front + deque->window > position) {
+            break;
+        }
+
+        sdeq_dequeue_front(&deque->positions, &front, sizeof(size_t));
+        sdeq_dequeue_front(&deque->elements, deque->scratch, element_size);
+    }
+}
+
+static void insert(smdeque_s * deque, const void * element, const size_t position, const size_t element_size) {
+    // rear candidates not smaller than element leave window before it does, so they can never be smallest again
+    size_t rear = 0;
+    while (!sdeq_is_empty(deque->elements) && deque->compare(sdeq_at(&deque->elements, 0, element_size), element) >= 0) {
+        sdeq_dequeue_rear(&deque->elements, deque->scratch, element_size);
+        sdeq_dequeue_rear(&deque->positions, &rear, sizeof(size_t));
+    }
+
+    sdeq_enqueue_rear(&deque->elements, element, element_size);
+    sdeq_enqueue_rear(&deque->positions, &position, sizeof(size_t));
+}
+
+static void destroy_position(void * position) {
+    (void)(position);
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <scale/sequential/deque/sring.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SRNG
+#   include <assert.h>
+#   define ASSERT_SRNG assert
+#endif
+
+#if !defined(REALLOC_SRNG) && !defined(FREE_SRNG)
+#   include <stdlib.h>
+#   ifndef REALLOC_SRNG
+#       define REALLOC_SRNG realloc
+#   endif
+#   ifndef FREE_SRNG
+#       define FREE_SRNG free
+#   endif
+#elif !defined(REALLOC_SRNG)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SRNG)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Copies 'n' elements starting at logical index out of ring, splitting them into right and left segments.
+/// @param deque Ring's deque.
+/// @param index Logical index of first element, counted from rear.
+/// @param elements Array of at least 'n' elements to copy into.
+/// @param n Number of elements to copy.
+/// @param element_size Size of a single element.
+static void ring_read(sdeque_s const * deque, const size_t index, char * elements, const size_t n, const size_t element_size);
+
+/// @brief Copies 'n' elements into ring starting at physical index, wrapping around array's end.
+/// @param deque Ring's deque.
+/// @param start Physical index of first slot.
+/// @param elements Array of elements to copy from.
+/// @param n Number of elements to copy, at most capacity.
+/// @param element_size Size of a single element.
+static void ring_write(sdeque_s * deque, const size_t start, char const * elements, const size_t n, const size_t element_size);
+
+sring_s srng_create(const size_t capacity, const size_t element_size) {
+    ASSERT_SRNG(capacity && "[ERROR] Ring's capacity can't be zero.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    void * elements = REALLOC_SRNG(NULL, capacity * element_size);
+    ASSERT_SRNG(elements && "[ERROR] Memory allocation failed.");
+
+    return (sring_s) { .deque = { .elements = elements, .size = 0, .current = 0, .capacity = capacity, }, };
+}
+
+void srng_destroy(sring_s * ring, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SRNG(ring && "[ERROR] 'ring' parameter is NULL.");
+    ASSERT_SRNG(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    for (sdeque_cursor_s cursor = sdeq_begin(&ring->deque, element_size); !sdeq_end(cursor); sdeq_next(&cursor)) {
+        destroy(cursor.element);
+    }
+    FREE_SRNG(ring->deque.elements);
+    (*ring) = (sring_s) { 0 };
+}
+
+bool srng_is_full(const sring_s ring) {
+    return ring.deque.size == ring.deque.capacity;
+}
+
+bool srng_is_empty(const sring_s ring) {
+    return !(ring.deque.size);
+}
+
+bool srng_push(sring_s * ring, const void * element, const size_t element_size) {
+    ASSERT_SRNG(ring && "[ERROR] 'ring' parameter is NULL.");
+    ASSERT_SRNG(ring->deque.capacity && "[ERROR] Ring has no capacity.");
+    ASSERT_SRNG(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    sdeque_s * deque = &ring->deque;
+
+    // next front index is the oldest element's slot once ring is full, same as sdeque's front enqueue otherwise
+    const size_t next_front_index = (deque->current + deque->size) % deque->capacity;
+    memcpy((char*)deque->elements + (next_front_index * element_size), element, element_size);
+
+    const bool is_overwritten = deque->size == deque->capacity;
+    if (is_overwritten) {
+        deque->current = (deque->current + 1) % deque->capacity;
+    } else {
+        deque->size++;
+    }
+
+    return is_overwritten;
+}
+
+size_t srng_push_n(sring_s * ring, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SRNG(ring && "[ERROR] 'ring' parameter is NULL.");
+    ASSERT_SRNG(ring->deque.capacity && "[ERROR] Ring has no capacity.");
+    ASSERT_SRNG((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    sdeque_s * deque = &ring->deque;
+
+    // elements before last capacity's worth would be overwritten before array ends, so they are skipped
+    const size_t skipped = n > deque->capacity ? n - deque->capacity : 0;
+    const size_t count = n - skipped;
+
+    const size_t next_front_index = (deque->current + deque->size) % deque->capacity;
+    ring_write(deque, next_front_index, (char const*)elements + (skipped * element_size), count, element_size);
+
+    const size_t free_size = deque->capacity - deque->size;
+    const size_t overwritten = count > free_size ? count - free_size : 0;
+    deque->size += count - overwritten;
+    deque->current = (deque->current + overwritten) % deque->capacity;
+
+    return skipped + overwritten;
+}
+
+size_t srng_peek_recent(const sring_s ring, void * elements, const size_t k, const size_t element_size) {
+    ASSERT_SRNG((elements || !k) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t count = k < ring.deque.size ? k : ring.deque.size;
+    ring_read(&ring.deque, ring.deque.size - count, elements, count, element_size);
+
+    return count;
+}
+
+size_t srng_snapshot(const sring_s ring, void * elements, const size_t element_size) {
+    ASSERT_SRNG((elements || !ring.deque.size) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SRNG(element_size && "[ERROR] Element's size can't be zero.");
+
+    ring_read(&ring.deque, 0, elements, ring.deque.size, element_size);
+
+    return ring.deque.size;
+}
+
+static void ring_read(sdeque_s const * deque, const size_t index, char * elements, const size_t n, const size_t element_size) {
+    if (!n) {
+        return;
+    }
+
+    // split range into right segment from start index until capacity and left segment from array's start
+    const size_t start = (deque->current + index) % deque->capacity;
+    const size_t right_size = (start + n) > deque->capacity ? deque->capacity - start : n;
+    memcpy(elements, (char*)deque->elements + (start * element_size), right_size * element_size);
+
+    const size_t left_size = n - right_size;
+    memcpy(elements + (right_size * element_size), deque->elements, left_size * element_size);
+}
+
+static void ring_write(sdeque_s * deque, const size_t start, char const * elements, const size_t n, const size_t element_size) {
+    if (!n) {
+        return;
+    }
+
+    const size_t right_size = (start + n) > deque->capacity ? deque->capacity - start : n;
+    memcpy((char*)deque->elements + (start * element_size), elements, right_size * element_size);
+
+    const size_t left_size = n - right_size;
+    memcpy(deque->elements, elements + (right_size * element_size), left_size * element_size);
+}
\ No newline at end of file
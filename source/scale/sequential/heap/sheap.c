@@ -0,0 +1,171 @@
+#include <scale/sequential/heap/sheap.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SHEP
+#   include <assert.h>
+#   define ASSERT_SHEP assert
+#endif
+
+#define SWAP_CHUNK_SHEP 64 // size of stack buffer in bytes that elements are swapped through
+
+/// @brief Swaps two elements through a small stack buffer, chunk by chunk, without allocating temporary memory.
+/// @param a First element.
+/// @param b Second element.
+/// @param element_size Size of a single element.
+static void swap(char * a, char * b, const size_t element_size);
+
+/// @brief Moves element at index up towards the top until its parent is not larger.
+/// @param heap Heap data structure.
+/// @param index Index of element to sift.
+/// @param element_size Size of a single element.
+static void sift_up(sheap_s * heap, size_t index, const size_t element_size);
+
+/// @brief Moves element at index down towards the leaves until none of its children is smaller.
+/// @param heap Heap data structure.
+/// @param index Index of element to sift.
+/// @param element_size Size of a single element.
+static void sift_down(sheap_s * heap, size_t index, const size_t element_size);
+
+sheap_s shep_create(const size_t arity, const compare_fn compare) {
+    ASSERT_SHEP(arity >= 2 && "[ERROR] Heap's arity can't be less than two.");
+    ASSERT_SHEP(compare && "[ERROR] 'compare' parameter is NULL.");
+
+    return (sheap_s) { .stack = sstk_create(), .compare = compare, .arity = arity, };
+}
+
+void shep_destroy(sheap_s * heap, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SHEP(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SHEP(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_destroy(&heap->stack, destroy, element_size);
+    (*heap) = (sheap_s) { 0 };
+}
+
+sheap_s shep_copy(const sheap_s heap, const copy_fn copy, const size_t element_size) {
+    ASSERT_SHEP(copy && "[ERROR] 'copy' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    return (sheap_s) { .stack = sstk_copy(heap.stack, copy, element_size), .compare = heap.compare, .arity = heap.arity, };
+}
+
+bool shep_is_full(const sheap_s heap) {
+    return sstk_is_full(heap.stack);
+}
+
+bool shep_is_empty(const sheap_s heap) {
+    return sstk_is_empty(heap.stack);
+}
+
+void shep_push(sheap_s * heap, const void * element, const size_t element_size) {
+    ASSERT_SHEP(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SHEP(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_push(&heap->stack, element, element_size);
+    sift_up(heap, heap->stack.size - 1, element_size);
+}
+
+void shep_push_n(sheap_s * heap, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SHEP(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SHEP((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t old_size = heap->stack.size;
+    for (size_t i = 0; i < n; ++i) {
+        sstk_push(&heap->stack, (char const*)elements + (i * element_size), element_size);
+    }
+
+    if (n >= old_size) { // bottom-up build costs O(size), cheaper than O(n log size) sifts once batch dominates heap
+        if (heap->stack.size < 2) {
+            return;
+        }
+        for (size_t i = ((heap->stack.size - 2) / heap->arity) + 1; i; --i) { // from last parent back to top
+            sift_down(heap, i - 1, element_size);
+        }
+    } else {
+        for (size_t i = old_size; i < heap->stack.size; ++i) {
+            sift_up(heap, i, element_size);
+        }
+    }
+}
+
+void shep_peek(const sheap_s heap, void * element, const size_t element_size) {
+    ASSERT_SHEP(heap.stack.size && "[ERROR] Heap is empty.");
+    ASSERT_SHEP(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    memcpy(element, heap.stack.elements, element_size);
+}
+
+void shep_pop(sheap_s * heap, void * element, const size_t element_size) {
+    ASSERT_SHEP(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SHEP(heap->stack.size && "[ERROR] Heap is empty.");
+    ASSERT_SHEP(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SHEP(element_size && "[ERROR] Element's size can't be zero.");
+
+    // move top to the end of the array, so that stack's pop takes it and shrinks array like it does for stack
+    char * elements = heap->stack.elements;
+    swap(elements, elements + ((heap->stack.size - 1) * element_size), element_size);
+    sstk_pop(&heap->stack, element, element_size);
+
+    if (heap->stack.size) {
+        sift_down(heap, 0, element_size);
+    }
+}
+
+static void swap(char * a, char * b, const size_t element_size) {
+    if (a == b) {
+        return;
+    }
+
+    char buffer[SWAP_CHUNK_SHEP];
+    for (size_t left = element_size; left;) {
+        const size_t chunk = left < SWAP_CHUNK_SHEP ? left : SWAP_CHUNK_SHEP;
+        memcpy(buffer, a, chunk);
+        memcpy(a, b, chunk);
+        memcpy(b, buffer, chunk);
+
+        a += chunk;
+        b += chunk;
+        left -= chunk;
+    }
+}
+
+static void sift_up(sheap_s * heap, size_t index, const size_t element_size) {
+    char * elements = heap->stack.elements;
+    while (index) {
+        const size_t parent = (index - 1) / heap->arity;
+        char * child_element = elements + (index * element_size), * parent_element = elements + (parent * element_size);
+        if (heap->compare(child_element, parent_element) >= 0) {
+            break;
+        }
+
+        swap(child_element, parent_element, element_size);
+        index = parent;
+    }
+}
+
+static void sift_down(sheap_s * heap, size_t index, const size_t element_size) {
+    char * elements = heap->stack.elements;
+    const size_t size = heap->stack.size;
+    for (size_t first = (index * heap->arity) + 1; first < size; first = (index * heap->arity) + 1) {
+        // find smallest child, children of a node are adjacent so this scans one contiguous run
+        const size_t last = size - first < heap->arity ? size : first + heap->arity;
+        size_t smallest = first;
+        for (size_t child = first + 1; child < last; ++child) {
+            if (heap->compare(elements + (child * element_size), elements + (smallest * element_size)) < 0) {
+                smallest = child;
+            }
+        }
+
+        char * parent_element = elements + (index * element_size), * child_element = elements + (smallest * element_size);
+        if (heap->compare(child_element, parent_element) >= 0) {
+            break;
+        }
+
+        swap(parent_element, child_element, element_size);
+        index = smallest;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include <scale/sequential/heap/sradix.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SRDX
+#   include <assert.h>
+#   define ASSERT_SRDX assert
+#endif
+
+#if !defined(REALLOC_SRDX) && !defined(FREE_SRDX)
+#   include <stdlib.h>
+#   ifndef REALLOC_SRDX
+#       define REALLOC_SRDX realloc
+#   endif
+#   ifndef FREE_SRDX
+#       define FREE_SRDX free
+#   endif
+#elif !defined(REALLOC_SRDX)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SRDX)
+#   error Free macro is not defined!
+#endif
+
+#define BUCKET_COUNT_SRDX (sizeof(uint64_t) * 8 + 1) // bucket of keys equal to last and one per differing highest bit
+
+/// @brief Does nothing, used to destroy moved out buckets.
+/// @param element Entry.
+static void ignore(void * element);
+
+/// @brief Calculates bucket of key relative to last key.
+/// @param last Last popped or peeked key.
+/// @param key Key not smaller than last.
+/// @return Zero if key is equal to last, else one plus index of highest bit that differs from last.
+static size_t bucket_of(const uint64_t last, const uint64_t key);
+
+/// @brief Moves entries of lowest non-empty bucket down, after making its smallest key the last one, unless zero
+/// bucket already has elements.
+/// @param heap Non-empty heap data structure.
+/// @param element_size Size of a single element.
+static void settle(sradix_s * heap, const size_t element_size);
+
+sradix_s srdx_create(const size_t element_size) {
+    ASSERT_SRDX(element_size && "[ERROR] Element's size can't be zero.");
+
+    char * buffer = REALLOC_SRDX(NULL, (BUCKET_COUNT_SRDX * sizeof(sstack_s)) + sizeof(uint64_t) + element_size);
+    ASSERT_SRDX(buffer && "[ERROR] Memory allocation failed.");
+
+    sstack_s * buckets = (sstack_s*)buffer;
+    for (size_t i = 0; i < BUCKET_COUNT_SRDX; ++i) {
+        buckets[i] = sstk_create();
+    }
+
+    return (sradix_s) {
+        .buckets = buckets, .scratch = buffer + (BUCKET_COUNT_SRDX * sizeof(sstack_s)), .last = 0, .size = 0,
+    };
+}
+
+void srdx_destroy(sradix_s * heap, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SRDX(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SRDX(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SRDX(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t entry_size = sizeof(uint64_t) + element_size;
+    for (size_t i = 0; i < BUCKET_COUNT_SRDX; ++i) {
+        for (sstack_cursor_s cursor = sstk_begin(&heap->buckets[i], entry_size); !sstk_end(cursor); sstk_next(&cursor)) {
+            destroy(cursor.element + sizeof(uint64_t));
+        }
+        sstk_destroy(&heap->buckets[i], ignore, entry_size);
+    }
+
+    FREE_SRDX(heap->buckets); // also frees scratch allocated with buckets
+    (*heap) = (sradix_s) { 0 };
+}
+
+bool srdx_is_empty(const sradix_s heap) {
+    return !(heap.size);
+}
+
+void srdx_push(sradix_s * heap, const uint64_t key, const void * element, const size_t element_size) {
+    ASSERT_SRDX(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SRDX(key >= heap->last && "[ERROR] Key is smaller than last popped key.");
+    ASSERT_SRDX(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SRDX(element_size && "[ERROR] Element's size can't be zero.");
+    ASSERT_SRDX(~(heap->size) && "[ERROR] Heap size variable will overflow.");
+
+    memcpy(heap->scratch, &key, sizeof(uint64_t));
+    memcpy(heap->scratch + sizeof(uint64_t), element, element_size);
+    sstk_push(&heap->buckets[bucket_of(heap->last, key)], heap->scratch, sizeof(uint64_t) + element_size);
+    heap->size++;
+}
+
+uint64_t srdx_peek(sradix_s * heap, void * element, const size_t element_size) {
+    ASSERT_SRDX(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SRDX(heap->size && "[ERROR] Can't peek empty heap.");
+    ASSERT_SRDX(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SRDX(element_size && "[ERROR] Element's size can't be zero.");
+
+    settle(heap, element_size);
+
+    sstk_peep(heap->buckets[0], heap->scratch, sizeof(uint64_t) + element_size);
+    memcpy(element, heap->scratch + sizeof(uint64_t), element_size);
+
+    return heap->last;
+}
+
+uint64_t srdx_pop(sradix_s * heap, void * element, const size_t element_size) {
+    ASSERT_SRDX(heap && "[ERROR] 'heap' parameter is NULL.");
+    ASSERT_SRDX(heap->size && "[ERROR] Can't pop empty heap.");
+    ASSERT_SRDX(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SRDX(element_size && "[ERROR] Element's size can't be zero.");
+
+    settle(heap, element_size);
+
+    sstk_pop(&heap->buckets[0], heap->scratch, sizeof(uint64_t) + element_size);
+    memcpy(element, heap->scratch + sizeof(uint64_t), element_size);
+    heap->size--;
+
+    return heap->last;
+}
+
+static void ignore(void * element) {
+    (void)(element);
+}
+
+static size_t bucket_of(const uint64_t last, const uint64_t key) {
+    const uint64_t difference = last ^ key;
+    return difference ? BUCKET_COUNT_SRDX - 1 - (size_t)__builtin_clzll(difference) : 0;
+}
+
+static void settle(sradix_s * heap, const size_t element_size) {
+    if (!sstk_is_empty(heap->buckets[0])) {
+        return;
+    }
+
+    size_t index = 1;
+    while (sstk_is_empty(heap->buckets[index])) {
+        index++;
+    }
+
+    const size_t entry_size = sizeof(uint64_t) + element_size;
+    sstack_s drained = heap->buckets[index]; // move bucket out, since its entries land only in lower buckets
+    heap->buckets[index] = sstk_create();
+
+    uint64_t minimum = UINT64_MAX, key = 0;
+    for (sstack_cursor_s cursor = sstk_begin(&drained, entry_size); !sstk_end(cursor); sstk_next(&cursor)) {
+        memcpy(&key, cursor.element, sizeof(uint64_t));
+        minimum = key < minimum ? key : minimum;
+    }
+
+    heap->last = minimum;
+    for (sstack_cursor_s cursor = sstk_begin(&drained, entry_size); !sstk_end(cursor); sstk_next(&cursor)) {
+        memcpy(&key, cursor.element, sizeof(uint64_t));
+        sstk_push(&heap->buckets[bucket_of(minimum, key)], cursor.element, entry_size);
+    }
+
+    sstk_destroy(&drained, ignore, entry_size);
+}
\ No newline at end of file
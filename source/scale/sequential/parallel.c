@@ -0,0 +1,122 @@
+#include "parallel.h"
+
+#include <pthread.h>
+
+/// @brief Single chunk of elements managed or merged by a thread in parallel map.
+struct map_task {
+    char * base; // start of chunk
+    size_t n, m; // number of elements in chunk and in adjacent chunk to merge with
+    size_t element_size; // size of a single element
+    manage_fn manage; // chunk manage function pointer
+    merge_fn merge; // adjacent chunks merge function pointer
+    void * arguments; // generic arguments for function pointers
+    bool is_threaded; // set if task runs on its own thread, which has to be joined
+};
+
+/// @brief Calculates number of chunks array is split into.
+/// @param size Number of elements in array.
+/// @param thread_count Maximum number of threads, including calling thread.
+/// @return Number of chunks, at most one per element.
+static size_t chunk_count_of(const size_t size, const size_t thread_count);
+
+/// @brief Manages task's chunk.
+/// @param task Map task.
+/// @return NULL.
+static void * manage_task(void * task);
+
+/// @brief Merges task's chunk with its adjacent chunk.
+/// @param task Map task.
+/// @return NULL.
+static void * merge_task(void * task);
+
+/// @brief Runs tasks on separate threads, while last task and tasks whose thread can't be created run on calling
+/// thread.
+/// @param tasks Array of tasks.
+/// @param threads Array of threads, one per task.
+/// @param count Number of tasks.
+/// @param routine Function pointer to run a single task.
+static void run_tasks(struct map_task * tasks, pthread_t * threads, const size_t count, void * (*routine)(void *));
+
+size_t parallel_map_scratch(const size_t size, const size_t thread_count) {
+    const size_t chunk_count = chunk_count_of(size, thread_count);
+    if (chunk_count < 2) {
+        return 0;
+    }
+
+    return (chunk_count * sizeof(struct map_task)) + ((chunk_count + 1) * sizeof(size_t)) + (chunk_count * sizeof(pthread_t));
+}
+
+void parallel_map(char * elements, const size_t size, const manage_fn manage, const merge_fn merge,
+    const size_t thread_count, const size_t element_size, void * arguments, void * scratch) {
+    const size_t chunk_count = chunk_count_of(size, thread_count);
+    if (chunk_count < 2) {
+        manage(elements, size, element_size, arguments);
+        return;
+    }
+
+    // scratch holds tasks, then chunk bounds and then threads
+    struct map_task * tasks = scratch;
+    size_t * bounds = (size_t*)(tasks + chunk_count);
+    pthread_t * threads = (pthread_t*)(bounds + chunk_count + 1);
+
+    // split elements into equal chunks, where last chunk also gets the remainder
+    for (size_t i = 0; i < chunk_count; ++i) {
+        bounds[i] = i * (size / chunk_count);
+    }
+    bounds[chunk_count] = size;
+
+    for (size_t i = 0; i < chunk_count; ++i) {
+        tasks[i] = (struct map_task) {
+            .base = elements + (bounds[i] * element_size), .n = bounds[i + 1] - bounds[i],
+            .element_size = element_size, .manage = manage, .arguments = arguments,
+        };
+    }
+    run_tasks(tasks, threads, chunk_count, manage_task);
+
+    // merge adjacent chunks in rounds, doubling merged chunk width each round
+    for (size_t width = 1; merge && width < chunk_count; width <<= 1) {
+        size_t count = 0;
+        for (size_t i = 0; i + width < chunk_count; i += (width << 1)) {
+            const size_t end = (i + (width << 1)) < chunk_count ? i + (width << 1) : chunk_count;
+            tasks[count++] = (struct map_task) {
+                .base = elements + (bounds[i] * element_size),
+                .n = bounds[i + width] - bounds[i], .m = bounds[end] - bounds[i + width],
+                .element_size = element_size, .merge = merge, .arguments = arguments,
+            };
+        }
+        run_tasks(tasks, threads, count, merge_task);
+    }
+}
+
+static size_t chunk_count_of(const size_t size, const size_t thread_count) {
+    return thread_count < size ? thread_count : size;
+}
+
+static void * manage_task(void * task) {
+    struct map_task * convert = task;
+    convert->manage(convert->base, convert->n, convert->element_size, convert->arguments);
+    return NULL;
+}
+
+static void * merge_task(void * task) {
+    struct map_task * convert = task;
+    convert->merge(convert->base, convert->n, convert->m, convert->element_size, convert->arguments);
+    return NULL;
+}
+
+static void run_tasks(struct map_task * tasks, pthread_t * threads, const size_t count, void * (*routine)(void *)) {
+    for (size_t i = 0; i < count - 1; ++i) {
+        tasks[i].is_threaded = !pthread_create(&threads[i], NULL, routine, &tasks[i]);
+        if (!tasks[i].is_threaded) { // thread couldn't be created, so chunk is handled here instead of being skipped
+            routine(&tasks[i]);
+        }
+    }
+
+    routine(&tasks[count - 1]);
+
+    for (size_t i = 0; i < count - 1; ++i) {
+        if (tasks[i].is_threaded) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+}
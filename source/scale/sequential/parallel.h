@@ -0,0 +1,44 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// Internal to library, shared by sequential containers whose elements are kept in a single contiguous array.
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifndef FUNCTION_POINTERS_TYPEDEF
+#define FUNCTION_POINTERS_TYPEDEF // guards typedefs shared by data structure headers from redefinition
+
+/// @brief Function pointer to destroy a single element in data structure. Based on 'free';
+typedef void   (*destroy_fn) (void * element);
+/// @brief Function pointer to copy a single element in data structure. Based on 'memcpy' and 'memmove'.
+typedef void * (*copy_fn) (void * dest, const void * src, size_t size);
+/// @brief Fucntion pointer to perform a single operation on element in data structure.
+typedef bool   (*operate_fn) (void * element, size_t size, void * args);
+/// @brief Function pointer to manage an array of finite number of element in data structure.
+typedef void   (*manage_fn) (void * base, size_t n, size_t size, void * arg);
+/// @brief Function pointer to merge two adjacent managed arrays of finite number of element in data structure.
+typedef void   (*merge_fn) (void * base, size_t left_n, size_t right_n, size_t size, void * arg);
+
+#endif // FUNCTION_POINTERS_TYPEDEF
+
+/// @brief Calculates size of scratch memory parallel map needs for its tasks, threads and chunk bounds.
+/// @param size Number of elements in array.
+/// @param thread_count Maximum number of threads, including calling thread.
+/// @return Size of scratch memory in bytes, or zero if array is managed on calling thread only.
+size_t parallel_map_scratch(const size_t size, const size_t thread_count);
+
+/// @brief Splits contiguous array into chunks, manages each chunk on a separate thread and merges them pairwise.
+/// @param elements Contiguous array of elements.
+/// @param size Number of elements in array.
+/// @param manage Function pointer to manage a single chunk of elements.
+/// @param merge Function pointer to merge two adjacent managed chunks, or NULL to leave chunks as they are.
+/// @param thread_count Maximum number of threads, including calling thread.
+/// @param element_size Size of a single element.
+/// @param arguments Generic arguments for function pointers.
+/// @param scratch Memory of 'parallel_map_scratch' size allocated by caller, can be NULL if that size is zero.
+/// @note Chunks whose thread can't be created are managed or merged on calling thread instead.
+void parallel_map(char * elements, const size_t size, const manage_fn manage, const merge_fn merge,
+    const size_t thread_count, const size_t element_size, void * arguments, void * scratch);
+
+#endif // PARALLEL_H
@@ -0,0 +1,138 @@
+#include <scale/sequential/queue/saqueue.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SAQU
+#   include <assert.h>
+#   define ASSERT_SAQU assert
+#endif
+
+#if !defined(REALLOC_SAQU) && !defined(FREE_SAQU)
+#   include <stdlib.h>
+#   ifndef REALLOC_SAQU
+#       define REALLOC_SAQU realloc
+#   endif
+#   ifndef FREE_SAQU
+#       define FREE_SAQU free
+#   endif
+#elif !defined(REALLOC_SAQU)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SAQU)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Moves every back element onto front, computing suffix aggregates on the way.
+/// @param queue Queue data structure.
+/// @param element_size Size of a single element.
+static void flip(saqueue_s * queue, const size_t element_size);
+
+/// @brief Leaves element as is, used to free back's array after its elements moved to front.
+/// @param element Single element.
+static void destroy_moved(void * element);
+
+saqueue_s saqu_create(const combine_fn combine, const size_t element_size) {
+    ASSERT_SAQU(combine && "[ERROR] 'combine' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    char * buffer = REALLOC_SAQU(NULL, 3 * element_size); // back aggregate followed by entry of two elements
+    ASSERT_SAQU(buffer && "[ERROR] Memory allocation failed.");
+
+    return (saqueue_s) {
+        .front = sstk_create(), .back = sstk_create(),
+        .back_aggregate = buffer, .scratch = buffer + element_size, .combine = combine,
+    };
+}
+
+void saqu_destroy(saqueue_s * queue, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SAQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SAQU(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_destroy(&queue->front, destroy, 2 * element_size); // entry starts with its element, so destroy gets it
+    sstk_destroy(&queue->back, destroy, element_size);
+    FREE_SAQU(queue->back_aggregate);
+    (*queue) = (saqueue_s) { 0 };
+}
+
+bool saqu_is_empty(const saqueue_s queue) {
+    return sstk_is_empty(queue.front) && sstk_is_empty(queue.back);
+}
+
+void saqu_enqueue(saqueue_s * queue, const void * element, const size_t element_size) {
+    ASSERT_SAQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SAQU(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (sstk_is_empty(queue->back)) {
+        memcpy(queue->back_aggregate, element, element_size);
+    } else {
+        queue->combine(queue->back_aggregate, element);
+    }
+    sstk_push(&queue->back, element, element_size);
+}
+
+void saqu_peek(const saqueue_s queue, void * element, const size_t element_size) {
+    ASSERT_SAQU(!saqu_is_empty(queue) && "[ERROR] Can't peek empty queue.");
+    ASSERT_SAQU(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    // with front empty the oldest element is at the bottom of back
+    char const * oldest = sstk_is_empty(queue.front) ? queue.back.elements
+        : (char*)queue.front.elements + ((queue.front.size - 1) * 2 * element_size);
+    memcpy(element, oldest, element_size);
+}
+
+void saqu_dequeue(saqueue_s * queue, void * element, const size_t element_size) {
+    ASSERT_SAQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SAQU(!saqu_is_empty(*queue) && "[ERROR] Can't dequeue empty queue.");
+    ASSERT_SAQU(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (sstk_is_empty(queue->front)) {
+        flip(queue, element_size);
+    }
+
+    sstk_pop(&queue->front, queue->scratch, 2 * element_size);
+    memcpy(element, queue->scratch, element_size);
+}
+
+void saqu_aggregate(const saqueue_s queue, void * aggregate, const size_t element_size) {
+    ASSERT_SAQU(!saqu_is_empty(queue) && "[ERROR] Can't aggregate empty queue.");
+    ASSERT_SAQU(aggregate && "[ERROR] 'aggregate' parameter is NULL.");
+    ASSERT_SAQU(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (sstk_is_empty(queue.front)) {
+        memcpy(aggregate, queue.back_aggregate, element_size);
+        return;
+    }
+
+    // front's top aggregate covers all older elements, back's aggregate all newer ones
+    char const * top = (char*)queue.front.elements + ((queue.front.size - 1) * 2 * element_size);
+    memcpy(aggregate, top + element_size, element_size);
+    if (!sstk_is_empty(queue.back)) {
+        queue.combine(aggregate, queue.back_aggregate);
+    }
+}
+
+static void flip(saqueue_s * queue, const size_t element_size) {
+    char const * elements = queue->back.elements;
+    char * scratch_element = queue->scratch, * scratch_aggregate = queue->scratch + element_size;
+
+    // newest element is moved first, so that oldest ends on front's top
+    for (size_t i = queue->back.size; i; --i) {
+        char const * element = elements + ((i - 1) * element_size);
+        memcpy(scratch_element, element, element_size);
+        memcpy(scratch_aggregate, element, element_size);
+        if (!sstk_is_empty(queue->front)) {
+            char const * below = (char*)queue->front.elements + ((queue->front.size - 1) * 2 * element_size);
+            queue->combine(scratch_aggregate, below + element_size);
+        }
+        sstk_push(&queue->front, queue->scratch, 2 * element_size);
+    }
+
+    sstk_destroy(&queue->back, destroy_moved, element_size);
+}
+
+static void destroy_moved(void * element) {
+    (void)(element);
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <scale/sequential/queue/sbqueue.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SBQU
+#   include <assert.h>
+#   define ASSERT_SBQU assert
+#endif
+
+#if !defined(REALLOC_SBQU) && !defined(FREE_SBQU)
+#   include <stdlib.h>
+#   ifndef REALLOC_SBQU
+#       define REALLOC_SBQU realloc
+#   endif
+#   ifndef FREE_SBQU
+#       define FREE_SBQU free
+#   endif
+#elif !defined(REALLOC_SBQU)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SBQU)
+#   error Free macro is not defined!
+#endif
+
+#ifndef EXPAND_CAPACITY_SBQU
+#   ifndef REALLOC_CHUNK_SBQU
+#       define REALLOC_CHUNK_SBQU (1 << 10)
+#   elif REALLOC_CHUNK_SBQU <= 0
+#       error 'REALLOC_CHUNK_SBQU' cannot be less than or equal to 0
+#   endif
+#   define EXPAND_CAPACITY_SBQU(capacity) ((capacity) ? (capacity) << 1 : REALLOC_CHUNK_SBQU) // Calculates next buffer's capacity.
+#endif
+
+#define TAG_SBQU sizeof(size_t) // size of length tag before each blob
+#define RECORD_SBQU(length) ((((length) + TAG_SBQU - 1) / TAG_SBQU * TAG_SBQU) + TAG_SBQU) // Calculates record's size.
+
+sbqueue_s sbqu_create(void) {
+    return (sbqueue_s) { 0 };
+}
+
+void sbqu_destroy(sbqueue_s * queue, const destroy_fn destroy) {
+    ASSERT_SBQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SBQU(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    for (size_t offset = queue->current; offset < queue->length;) {
+        const size_t length = *(size_t*)(queue->bytes + offset);
+        destroy(queue->bytes + offset + TAG_SBQU);
+        offset += RECORD_SBQU(length);
+    }
+
+    FREE_SBQU(queue->bytes);
+    (*queue) = (sbqueue_s) { 0 };
+}
+
+bool sbqu_is_empty(const sbqueue_s queue) {
+    return !(queue.size);
+}
+
+void sbqu_enqueue(sbqueue_s * queue, const void * blob, const size_t length) {
+    ASSERT_SBQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SBQU(blob && "[ERROR] 'blob' parameter is NULL.");
+    ASSERT_SBQU(length < RECORD_SBQU(length) && "[ERROR] Blob's length will overflow.");
+
+    const size_t record = RECORD_SBQU(length);
+    ASSERT_SBQU(queue->length + record > queue->length && "[ERROR] Queue's buffer length will overflow.");
+
+    if (queue->length + record > queue->capacity) {
+        const size_t used = queue->length - queue->current;
+        // only move records to front when dequeued bytes are at least half the buffer, else moves aren't amortized
+        if (queue->current >= used && used + record <= queue->capacity) {
+            memmove(queue->bytes, queue->bytes + queue->current, used);
+        } else {
+            size_t expand = queue->capacity;
+            do {
+                expand = EXPAND_CAPACITY_SBQU(expand);
+            } while (expand < used + record);
+
+            char * bytes = REALLOC_SBQU(NULL, expand);
+            ASSERT_SBQU(bytes && "[ERROR] Memory allocation failed.");
+            if (used) {
+                memcpy(bytes, queue->bytes + queue->current, used);
+            }
+
+            FREE_SBQU(queue->bytes);
+            queue->bytes = bytes;
+            queue->capacity = expand;
+        }
+        queue->current = 0;
+        queue->length = used;
+    }
+
+    char * base = queue->bytes + queue->length;
+    (*(size_t*)(base)) = length;
+    memcpy(base + TAG_SBQU, blob, length);
+
+    queue->length += record;
+    queue->size++;
+}
+
+void * sbqu_peek(const sbqueue_s queue, size_t * length) {
+    ASSERT_SBQU(queue.size && "[ERROR] Can't peek empty queue.");
+    ASSERT_SBQU(length && "[ERROR] 'length' parameter is NULL.");
+
+    (*length) = *(size_t*)(queue.bytes + queue.current);
+    return queue.bytes + queue.current + TAG_SBQU;
+}
+
+void * sbqu_dequeue(sbqueue_s * queue, size_t * length) {
+    ASSERT_SBQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SBQU(length && "[ERROR] 'length' parameter is NULL.");
+    ASSERT_SBQU(queue->size && "[ERROR] Can't dequeue empty queue.");
+
+    char * blob = queue->bytes + queue->current + TAG_SBQU;
+    (*length) = *(size_t*)(queue->bytes + queue->current);
+    queue->current += RECORD_SBQU(*length);
+    queue->size--;
+
+    if (!queue->size) { // rewind empty queue, blob's bytes are left as they are until next enqueue
+        queue->current = queue->length = 0;
+    }
+
+    return blob;
+}
+
+void sbqu_foreach(sbqueue_s const * queue, const operate_fn operate, void * arguments) {
+    ASSERT_SBQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SBQU(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    for (size_t offset = queue->current; offset < queue->length;) {
+        const size_t length = *(size_t*)(queue->bytes + offset);
+        if (!operate(queue->bytes + offset + TAG_SBQU, length, arguments)) {
+            break;
+        }
+        offset += RECORD_SBQU(length);
+    }
+}
\ No newline at end of file
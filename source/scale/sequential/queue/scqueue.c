@@ -0,0 +1,119 @@
+#include <scale/sequential/queue/scqueue.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SCQU
+#   include <assert.h>
+#   define ASSERT_SCQU assert
+#endif
+
+#if !defined(REALLOC_SCQU) && !defined(FREE_SCQU)
+#   include <stdlib.h>
+#   ifndef REALLOC_SCQU
+#       define REALLOC_SCQU realloc
+#   endif
+#   ifndef FREE_SCQU
+#       define FREE_SCQU free
+#   endif
+#elif !defined(REALLOC_SCQU)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SCQU)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Does nothing, used to destroy column queues after their records were destroyed.
+/// @param element Field.
+static void ignore(void * element);
+
+scqueue_s scqu_create(column_s const * schema, const size_t count) {
+    ASSERT_SCQU(schema && "[ERROR] 'schema' parameter is NULL.");
+    ASSERT_SCQU(count && "[ERROR] Column count can't be zero.");
+
+    size_t extent = 0; // record's size up to end of its last column
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_SCQU(schema[i].size && "[ERROR] Column's size can't be zero.");
+        extent = (schema[i].offset + schema[i].size) > extent ? schema[i].offset + schema[i].size : extent;
+    }
+
+    char * buffer = REALLOC_SCQU(NULL, (count * (sizeof(squeue_s) + sizeof(column_s))) + extent);
+    ASSERT_SCQU(buffer && "[ERROR] Memory allocation failed.");
+
+    squeue_s * columns = (squeue_s*)buffer;
+    column_s * schema_copy = (column_s*)(buffer + (count * sizeof(squeue_s)));
+    for (size_t i = 0; i < count; ++i) {
+        columns[i] = sque_create();
+        schema_copy[i] = schema[i];
+    }
+
+    return (scqueue_s) {
+        .columns = columns, .schema = schema_copy, .count = count,
+        .scratch = buffer + (count * (sizeof(squeue_s) + sizeof(column_s))),
+    };
+}
+
+void scqu_destroy(scqueue_s * queue, const destroy_fn destroy) {
+    ASSERT_SCQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SCQU(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    for (size_t i = 0; i < queue->columns[0].size; ++i) {
+        for (size_t c = 0; c < queue->count; ++c) {
+            memcpy(queue->scratch + queue->schema[c].offset, sque_at(&queue->columns[c], i, queue->schema[c].size), queue->schema[c].size);
+        }
+        destroy(queue->scratch);
+    }
+
+    for (size_t c = 0; c < queue->count; ++c) {
+        sque_destroy(&queue->columns[c], ignore, queue->schema[c].size);
+    }
+    FREE_SCQU(queue->columns); // also frees schema and scratch allocated with columns
+
+    (*queue) = (scqueue_s) { 0 };
+}
+
+bool scqu_is_empty(const scqueue_s queue) {
+    return sque_is_empty(queue.columns[0]);
+}
+
+void scqu_enqueue(scqueue_s * queue, const void * record) {
+    ASSERT_SCQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SCQU(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < queue->count; ++c) {
+        sque_enqueue(&queue->columns[c], (char const*)(record) + queue->schema[c].offset, queue->schema[c].size);
+    }
+}
+
+void scqu_peek(const scqueue_s queue, void * record) {
+    ASSERT_SCQU(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < queue.count; ++c) {
+        sque_peek(queue.columns[c], (char*)(record) + queue.schema[c].offset, queue.schema[c].size);
+    }
+}
+
+void scqu_dequeue(scqueue_s * queue, void * record) {
+    ASSERT_SCQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SCQU(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < queue->count; ++c) {
+        sque_dequeue(&queue->columns[c], (char*)(record) + queue->schema[c].offset, queue->schema[c].size);
+    }
+}
+
+void scqu_foreach_column(scqueue_s const * queue, const size_t column, const operate_fn operate, void * arguments) {
+    ASSERT_SCQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SCQU(column < queue->count && "[ERROR] Column index out of schema's bounds.");
+
+    sque_foreach(&queue->columns[column], operate, queue->schema[column].size, arguments);
+}
+
+void scqu_map_column(scqueue_s const * queue, const size_t column, const manage_fn manage, void * arguments) {
+    ASSERT_SCQU(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SCQU(column < queue->count && "[ERROR] Column index out of schema's bounds.");
+
+    sque_map(&queue->columns[column], manage, queue->schema[column].size, arguments);
+}
+
+static void ignore(void * element) {
+    (void)(element);
+}
\ No newline at end of file
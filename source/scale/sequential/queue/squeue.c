@@ -1,4 +1,5 @@
 #include <scale/sequential/queue/squeue.h>
+#include "../parallel.h"
 
 #include <string.h>
 
@@ -140,6 +141,23 @@ void sque_dequeue(squeue_s * queue, void * element, const size_t element_size) {
     queue->current = 0;
 }
 
+void * sque_at(squeue_s const * queue, const size_t index, const size_t element_size) {
+    ASSERT_SQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SQUE(index < queue->size && "[ERROR] Index out of queue's bounds.");
+    ASSERT_SQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    return (char*)queue->elements + ((queue->current + index) * element_size);
+}
+
+void sque_set(squeue_s * queue, const size_t index, const void * element, const size_t element_size) {
+    ASSERT_SQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SQUE(index < queue->size && "[ERROR] Index out of queue's bounds.");
+    ASSERT_SQUE(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    memcpy((char*)queue->elements + ((queue->current + index) * element_size), element, element_size);
+}
+
 void sque_foreach(squeue_s const * queue, const operate_fn operate, const size_t element_size, void * arguments) {
     ASSERT_SQUE(queue && "[ERROR] 'queue' parameter is NULL.");
     ASSERT_SQUE(operate && "[ERROR] 'operate' parameter is NULL.");
@@ -158,3 +176,17 @@ void sque_map(squeue_s const * queue, const manage_fn manage, const size_t eleme
 
     manage((char*)queue->elements + (queue->current * element_size), queue->size, element_size, arguments);
 }
+
+void sque_map_parallel(squeue_s const * queue, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments) {
+    ASSERT_SQUE(queue && "[ERROR] 'queue' parameter is NULL.");
+    ASSERT_SQUE(manage && "[ERROR] 'manage' parameter is NULL.");
+    ASSERT_SQUE(thread_count && "[ERROR] Thread count can't be zero.");
+    ASSERT_SQUE(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t scratch_size = parallel_map_scratch(queue->size, thread_count);
+    void * scratch = scratch_size ? REALLOC_SQUE(NULL, scratch_size) : NULL;
+    ASSERT_SQUE((scratch || !scratch_size) && "[ERROR] Memory allocation failed.");
+
+    parallel_map((char*)queue->elements + (queue->current * element_size), queue->size, manage, merge, thread_count, element_size, arguments, scratch);
+    FREE_SQUE(scratch);
+}
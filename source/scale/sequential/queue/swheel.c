@@ -0,0 +1,295 @@
+#include <scale/sequential/queue/swheel.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SWHL
+#   include <assert.h>
+#   define ASSERT_SWHL assert
+#endif
+
+#if !defined(REALLOC_SWHL) && !defined(FREE_SWHL)
+#   include <stdlib.h>
+#   ifndef REALLOC_SWHL
+#       define REALLOC_SWHL realloc
+#   endif
+#   ifndef FREE_SWHL
+#       define FREE_SWHL free
+#   endif
+#elif !defined(REALLOC_SWHL)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SWHL)
+#   error Free macro is not defined!
+#endif
+
+#ifndef SLOT_BITS_SWHL
+#   define SLOT_BITS_SWHL 6
+#elif SLOT_BITS_SWHL <= 0
+#   error 'SLOT_BITS_SWHL' cannot be less than or equal to 0
+#endif
+
+#ifndef LEVEL_COUNT_SWHL
+#   define LEVEL_COUNT_SWHL 4
+#elif LEVEL_COUNT_SWHL <= 0
+#   error 'LEVEL_COUNT_SWHL' cannot be less than or equal to 0
+#endif
+
+#if (SLOT_BITS_SWHL * LEVEL_COUNT_SWHL) >= 64
+#   error Wheel's horizon doesn't fit into 64 bit ticks.
+#endif
+
+#define SLOT_COUNT_SWHL ((size_t)1 << SLOT_BITS_SWHL) // number of buckets in a single level
+#define SLOT_MASK_SWHL ((uint64_t)(SLOT_COUNT_SWHL - 1)) // mask of tick's bits that index a single level
+#define HORIZON_SWHL ((uint64_t)1 << (SLOT_BITS_SWHL * LEVEL_COUNT_SWHL)) // number of ticks spanned by all levels
+
+/// @brief Record of a single timer slot.
+struct timer {
+    uint64_t deadline; // tick at which timer expires
+    uint32_t generation; // odd while slot holds a pending timer, incremented on insert and on release
+};
+
+/// @brief Does nothing, used to destroy queues and stacks of handles and records.
+/// @param element Handle or record.
+static void ignore(void * element);
+
+/// @brief Gets record of pending timer.
+/// @param wheel Wheel data structure.
+/// @param handle Handle of timer.
+/// @return Pointer to timer's record if handle's timer is pending, NULL otherwise.
+static struct timer * record(swheel_s const * wheel, const uint64_t handle);
+
+/// @brief Releases timer's slot to be reused by next insert, which leaves its handles stale.
+/// @param wheel Wheel data structure.
+/// @param index Index of timer's slot.
+static void release(swheel_s * wheel, const size_t index);
+
+/// @brief Enqueues handle into expired queue if it's due, else into bucket of lowest level whose span covers it.
+/// @param wheel Wheel data structure.
+/// @param handle Handle of pending timer.
+/// @param deadline Timer's deadline, not earlier than wheel's current tick.
+static void place(swheel_s * wheel, const uint64_t handle, const uint64_t deadline);
+
+/// @brief Empties bucket by placing each of its pending timers again, relative to wheel's current tick.
+/// @param wheel Wheel data structure.
+/// @param bucket Bucket to cascade into lower levels.
+static void cascade(swheel_s * wheel, squeue_s * bucket);
+
+swheel_s swhl_create(void) {
+    squeue_s * buckets = REALLOC_SWHL(NULL, LEVEL_COUNT_SWHL * SLOT_COUNT_SWHL * sizeof(squeue_s));
+    ASSERT_SWHL(buckets && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < LEVEL_COUNT_SWHL * SLOT_COUNT_SWHL; ++i) {
+        buckets[i] = sque_create();
+    }
+
+    return (swheel_s) {
+        .buckets = buckets, .expired = sque_create(),
+        .timers = sstk_create(), .elements = sstk_create(), .vacant = sstk_create(),
+        .now = 0, .size = 0, .taken = 0,
+    };
+}
+
+void swhl_destroy(swheel_s * wheel, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SWHL(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    ASSERT_SWHL(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SWHL(element_size && "[ERROR] Element's size can't be zero.");
+
+    struct timer const * timers = wheel->timers.elements;
+    for (size_t i = 0; i < wheel->timers.size; ++i) {
+        if (timers[i].generation & 1) { // only pending timers still own their elements
+            destroy((char*)(wheel->elements.elements) + (i * element_size));
+        }
+    }
+
+    for (size_t i = 0; i < LEVEL_COUNT_SWHL * SLOT_COUNT_SWHL; ++i) {
+        sque_destroy(&wheel->buckets[i], ignore, sizeof(uint64_t));
+    }
+    FREE_SWHL(wheel->buckets);
+
+    sque_destroy(&wheel->expired, ignore, sizeof(uint64_t));
+    sstk_destroy(&wheel->timers, ignore, sizeof(struct timer));
+    sstk_destroy(&wheel->elements, ignore, element_size);
+    sstk_destroy(&wheel->vacant, ignore, sizeof(size_t));
+
+    (*wheel) = (swheel_s) { 0 };
+}
+
+bool swhl_is_empty(const swheel_s wheel) {
+    return !(wheel.size);
+}
+
+bool swhl_is_pending(const swheel_s wheel, const uint64_t handle) {
+    return record(&wheel, handle) != NULL;
+}
+
+uint64_t swhl_insert(swheel_s * wheel, const uint64_t delay, const void * element, const size_t element_size) {
+    ASSERT_SWHL(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    ASSERT_SWHL(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SWHL(element_size && "[ERROR] Element's size can't be zero.");
+    ASSERT_SWHL(delay <= (UINT64_MAX - wheel->now) && "[ERROR] Timer's deadline will overflow.");
+
+    size_t index = 0;
+    if (sstk_is_empty(wheel->vacant)) { // no released slot to reuse, so append new one
+        ASSERT_SWHL(wheel->timers.size < UINT32_MAX && "[ERROR] Wheel's timer slots will overflow.");
+
+        index = wheel->timers.size;
+        const struct timer timer = { 0 };
+        sstk_push(&wheel->timers, &timer, sizeof(struct timer));
+        sstk_push(&wheel->elements, element, element_size);
+    } else {
+        sstk_pop(&wheel->vacant, &index, sizeof(size_t));
+        memcpy((char*)(wheel->elements.elements) + (index * element_size), element, element_size);
+    }
+
+    struct timer * timer = (struct timer*)(wheel->timers.elements) + index;
+    timer->deadline = wheel->now + delay;
+    timer->generation++;
+
+    const uint64_t handle = ((uint64_t)(timer->generation) << 32) | (uint64_t)(index);
+    place(wheel, handle, timer->deadline);
+    wheel->size++;
+
+    return handle;
+}
+
+bool swhl_cancel(swheel_s * wheel, const uint64_t handle, void * element, const size_t element_size) {
+    ASSERT_SWHL(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    ASSERT_SWHL(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SWHL(element_size && "[ERROR] Element's size can't be zero.");
+
+    if (!record(wheel, handle)) {
+        return false;
+    }
+
+    const size_t index = (size_t)(handle & UINT32_MAX);
+    memcpy(element, (char*)(wheel->elements.elements) + (index * element_size), element_size);
+    release(wheel, index);
+
+    return true;
+}
+
+void swhl_advance(swheel_s * wheel, const uint64_t ticks) {
+    ASSERT_SWHL(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    ASSERT_SWHL(ticks <= (UINT64_MAX - wheel->now) && "[ERROR] Wheel's tick will overflow.");
+
+    for (uint64_t i = 0; i < ticks; ++i) {
+        wheel->now++;
+
+        // each level whose lower levels wrapped around cascades its current bucket down
+        for (size_t level = 1; level < LEVEL_COUNT_SWHL; ++level) {
+            const unsigned shift = (unsigned)(SLOT_BITS_SWHL * level);
+            if (wheel->now & (((uint64_t)1 << shift) - 1)) {
+                break;
+            }
+            const size_t slot = (size_t)((wheel->now >> shift) & SLOT_MASK_SWHL);
+            cascade(wheel, &wheel->buckets[(level << SLOT_BITS_SWHL) + slot]);
+        }
+
+        squeue_s * bucket = &wheel->buckets[(size_t)(wheel->now & SLOT_MASK_SWHL)];
+        if (sque_is_empty(*bucket)) {
+            continue;
+        }
+
+        if (sque_is_empty(wheel->expired)) { // hand bucket's storage over to expired queue instead of copying it
+            wheel->expired = (*bucket);
+            (*bucket) = sque_create();
+            continue;
+        }
+
+        for (squeue_cursor_s cursor = sque_begin(bucket, sizeof(uint64_t)); !sque_end(cursor); sque_next(&cursor)) {
+            sque_enqueue(&wheel->expired, cursor.element, sizeof(uint64_t));
+        }
+        sque_destroy(bucket, ignore, sizeof(uint64_t));
+        (*bucket) = sque_create();
+    }
+}
+
+size_t swhl_expire(swheel_s * wheel, void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SWHL(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    ASSERT_SWHL(elements && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SWHL(element_size && "[ERROR] Element's size can't be zero.");
+
+    // take handles by moving past them instead of dequeuing, so expired queue is never compacted while drained
+    char * output = elements;
+    size_t count = 0;
+    while (count < n && wheel->taken < wheel->expired.size) {
+        uint64_t const * handle = sque_at(&wheel->expired, wheel->taken++, sizeof(uint64_t));
+        if (!record(wheel, (*handle))) { // skip stale handle of cancelled timer
+            continue;
+        }
+
+        const size_t index = (size_t)((*handle) & UINT32_MAX);
+        memcpy(output, (char*)(wheel->elements.elements) + (index * element_size), element_size);
+        release(wheel, index);
+
+        output += element_size;
+        count++;
+    }
+
+    if (wheel->taken == wheel->expired.size) {
+        sque_destroy(&wheel->expired, ignore, sizeof(uint64_t));
+        wheel->expired = sque_create();
+        wheel->taken = 0;
+    }
+
+    return count;
+}
+
+static void ignore(void * element) {
+    (void)(element);
+}
+
+static struct timer * record(swheel_s const * wheel, const uint64_t handle) {
+    const size_t index = (size_t)(handle & UINT32_MAX);
+    if (index >= wheel->timers.size) {
+        return NULL;
+    }
+
+    struct timer * timer = (struct timer*)(wheel->timers.elements) + index;
+    const bool is_pending = (timer->generation & 1) && (timer->generation == (uint32_t)(handle >> 32));
+
+    return is_pending ? timer : NULL;
+}
+
+static void release(swheel_s * wheel, const size_t index) {
+    struct timer * timer = (struct timer*)(wheel->timers.elements) + index;
+    timer->generation++;
+
+    sstk_push(&wheel->vacant, &index, sizeof(size_t));
+    wheel->size--;
+}
+
+static void place(swheel_s * wheel, const uint64_t handle, const uint64_t deadline) {
+    const uint64_t delta = deadline - wheel->now;
+    if (!delta) {
+        sque_enqueue(&wheel->expired, &handle, sizeof(uint64_t));
+        return;
+    }
+
+    // timer past horizon waits in last level's furthest bucket and gets placed again once that bucket cascades
+    const uint64_t target = delta < HORIZON_SWHL ? deadline : wheel->now + (HORIZON_SWHL - 1);
+    const uint64_t span = target - wheel->now;
+
+    size_t level = 0;
+    while (level < LEVEL_COUNT_SWHL - 1 && (span >> (SLOT_BITS_SWHL * (level + 1)))) {
+        level++;
+    }
+
+    const size_t slot = (size_t)((target >> (SLOT_BITS_SWHL * level)) & SLOT_MASK_SWHL);
+    sque_enqueue(&wheel->buckets[(level << SLOT_BITS_SWHL) + slot], &handle, sizeof(uint64_t));
+}
+
+static void cascade(swheel_s * wheel, squeue_s * bucket) {
+    squeue_s drained = (*bucket); // move bucket out, since none of its timers can land back in it
+    (*bucket) = sque_create();
+
+    for (squeue_cursor_s cursor = sque_begin(&drained, sizeof(uint64_t)); !sque_end(cursor); sque_next(&cursor)) {
+        const uint64_t handle = (*(uint64_t*)cursor.element);
+
+        struct timer const * timer = record(wheel, handle);
+        if (timer) { // stale handles of cancelled timers are dropped here
+            place(wheel, handle, timer->deadline);
+        }
+    }
+
+    sque_destroy(&drained, ignore, sizeof(uint64_t));
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <scale/sequential/stack/sbstack.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SBST
+#   include <assert.h>
+#   define ASSERT_SBST assert
+#endif
+
+#if !defined(REALLOC_SBST) && !defined(FREE_SBST)
+#   include <stdlib.h>
+#   ifndef REALLOC_SBST
+#       define REALLOC_SBST realloc
+#   endif
+#   ifndef FREE_SBST
+#       define FREE_SBST free
+#   endif
+#elif !defined(REALLOC_SBST)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SBST)
+#   error Free macro is not defined!
+#endif
+
+#ifndef EXPAND_CAPACITY_SBST
+#   ifndef REALLOC_CHUNK_SBST
+#       define REALLOC_CHUNK_SBST (1 << 10)
+#   elif REALLOC_CHUNK_SBST <= 0
+#       error 'REALLOC_CHUNK_SBST' cannot be less than or equal to 0
+#   endif
+#   define EXPAND_CAPACITY_SBST(capacity) ((capacity) ? (capacity) << 1 : REALLOC_CHUNK_SBST) // Calculates next buffer's capacity.
+#endif
+
+#define TAG_SBST sizeof(size_t) // size of length tag before and after each blob
+#define RECORD_SBST(length) ((((length) + TAG_SBST - 1) / TAG_SBST * TAG_SBST) + (2 * TAG_SBST)) // Calculates record's size.
+
+sbstack_s sbst_create(void) {
+    return (sbstack_s) { 0 };
+}
+
+void sbst_destroy(sbstack_s * stack, const destroy_fn destroy) {
+    ASSERT_SBST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SBST(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    for (size_t offset = 0; offset < stack->length;) {
+        const size_t length = *(size_t*)(stack->bytes + offset);
+        destroy(stack->bytes + offset + TAG_SBST);
+        offset += RECORD_SBST(length);
+    }
+
+    FREE_SBST(stack->bytes);
+    (*stack) = (sbstack_s) { 0 };
+}
+
+bool sbst_is_empty(const sbstack_s stack) {
+    return !(stack.size);
+}
+
+void sbst_push(sbstack_s * stack, const void * blob, const size_t length) {
+    ASSERT_SBST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SBST(blob && "[ERROR] 'blob' parameter is NULL.");
+    ASSERT_SBST(length < RECORD_SBST(length) && "[ERROR] Blob's length will overflow.");
+
+    const size_t record = RECORD_SBST(length);
+    ASSERT_SBST(stack->length + record > stack->length && "[ERROR] Stack's buffer length will overflow.");
+
+    if (stack->length + record > stack->capacity) { // grow geometrically so that many small blobs cost few reallocs
+        size_t expand = stack->capacity;
+        do {
+            expand = EXPAND_CAPACITY_SBST(expand);
+        } while (expand < stack->length + record);
+
+        stack->bytes = REALLOC_SBST(stack->bytes, expand);
+        ASSERT_SBST(stack->bytes && "[ERROR] Memory allocation failed.");
+        stack->capacity = expand;
+    }
+
+    char * base = stack->bytes + stack->length;
+    (*(size_t*)(base)) = length;
+    memcpy(base + TAG_SBST, blob, length);
+    (*(size_t*)(base + record - TAG_SBST)) = length; // tag after blob lets pop find the record's start
+
+    stack->length += record;
+    stack->size++;
+}
+
+void * sbst_peep(const sbstack_s stack, size_t * length) {
+    ASSERT_SBST(stack.size && "[ERROR] Stack is empty.");
+    ASSERT_SBST(length && "[ERROR] 'length' parameter is NULL.");
+
+    (*length) = *(size_t*)(stack.bytes + stack.length - TAG_SBST);
+    return stack.bytes + stack.length - RECORD_SBST(*length) + TAG_SBST;
+}
+
+void * sbst_pop(sbstack_s * stack, size_t * length) {
+    ASSERT_SBST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SBST(length && "[ERROR] 'length' parameter is NULL.");
+    ASSERT_SBST(stack->size && "[ERROR] Stack is empty.");
+
+    (*length) = *(size_t*)(stack->bytes + stack->length - TAG_SBST);
+    stack->length -= RECORD_SBST(*length);
+    stack->size--;
+
+    return stack->bytes + stack->length + TAG_SBST;
+}
+
+void sbst_foreach(sbstack_s const * stack, const operate_fn operate, void * arguments) {
+    ASSERT_SBST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SBST(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    for (size_t offset = 0; offset < stack->length;) {
+        const size_t length = *(size_t*)(stack->bytes + offset);
+        if (!operate(stack->bytes + offset + TAG_SBST, length, arguments)) {
+            break;
+        }
+        offset += RECORD_SBST(length);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <scale/sequential/stack/scstack.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SCST
+#   include <assert.h>
+#   define ASSERT_SCST assert
+#endif
+
+#if !defined(REALLOC_SCST) && !defined(FREE_SCST)
+#   include <stdlib.h>
+#   ifndef REALLOC_SCST
+#       define REALLOC_SCST realloc
+#   endif
+#   ifndef FREE_SCST
+#       define FREE_SCST free
+#   endif
+#elif !defined(REALLOC_SCST)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SCST)
+#   error Free macro is not defined!
+#endif
+
+/// @brief Does nothing, used to destroy column stacks after their records were destroyed.
+/// @param element Field.
+static void ignore(void * element);
+
+scstack_s scst_create(column_s const * schema, const size_t count) {
+    ASSERT_SCST(schema && "[ERROR] 'schema' parameter is NULL.");
+    ASSERT_SCST(count && "[ERROR] Column count can't be zero.");
+
+    size_t extent = 0; // record's size up to end of its last column
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_SCST(schema[i].size && "[ERROR] Column's size can't be zero.");
+        extent = (schema[i].offset + schema[i].size) > extent ? schema[i].offset + schema[i].size : extent;
+    }
+
+    char * buffer = REALLOC_SCST(NULL, (count * (sizeof(sstack_s) + sizeof(column_s))) + extent);
+    ASSERT_SCST(buffer && "[ERROR] Memory allocation failed.");
+
+    sstack_s * columns = (sstack_s*)buffer;
+    column_s * schema_copy = (column_s*)(buffer + (count * sizeof(sstack_s)));
+    for (size_t i = 0; i < count; ++i) {
+        columns[i] = sstk_create();
+        schema_copy[i] = schema[i];
+    }
+
+    return (scstack_s) {
+        .columns = columns, .schema = schema_copy, .count = count,
+        .scratch = buffer + (count * (sizeof(sstack_s) + sizeof(column_s))),
+    };
+}
+
+void scst_destroy(scstack_s * stack, const destroy_fn destroy) {
+    ASSERT_SCST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SCST(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    for (size_t i = 0; i < stack->columns[0].size; ++i) {
+        for (size_t c = 0; c < stack->count; ++c) {
+            const size_t size = stack->schema[c].size;
+            memcpy(stack->scratch + stack->schema[c].offset, (char*)(stack->columns[c].elements) + (i * size), size);
+        }
+        destroy(stack->scratch);
+    }
+
+    for (size_t c = 0; c < stack->count; ++c) {
+        sstk_destroy(&stack->columns[c], ignore, stack->schema[c].size);
+    }
+    FREE_SCST(stack->columns); // also frees schema and scratch allocated with columns
+
+    (*stack) = (scstack_s) { 0 };
+}
+
+bool scst_is_empty(const scstack_s stack) {
+    return sstk_is_empty(stack.columns[0]);
+}
+
+void scst_push(scstack_s * stack, const void * record) {
+    ASSERT_SCST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SCST(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < stack->count; ++c) {
+        sstk_push(&stack->columns[c], (char const*)(record) + stack->schema[c].offset, stack->schema[c].size);
+    }
+}
+
+void scst_peep(const scstack_s stack, void * record) {
+    ASSERT_SCST(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < stack.count; ++c) {
+        sstk_peep(stack.columns[c], (char*)(record) + stack.schema[c].offset, stack.schema[c].size);
+    }
+}
+
+void scst_pop(scstack_s * stack, void * record) {
+    ASSERT_SCST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SCST(record && "[ERROR] 'record' parameter is NULL.");
+
+    for (size_t c = 0; c < stack->count; ++c) {
+        sstk_pop(&stack->columns[c], (char*)(record) + stack->schema[c].offset, stack->schema[c].size);
+    }
+}
+
+void scst_foreach_column(scstack_s const * stack, const size_t column, const operate_fn operate, void * arguments) {
+    ASSERT_SCST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SCST(column < stack->count && "[ERROR] Column index out of schema's bounds.");
+
+    sstk_foreach(&stack->columns[column], operate, stack->schema[column].size, arguments);
+}
+
+void scst_map_column(scstack_s const * stack, const size_t column, const manage_fn manage, void * arguments) {
+    ASSERT_SCST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SCST(column < stack->count && "[ERROR] Column index out of schema's bounds.");
+
+    sstk_map(&stack->columns[column], manage, stack->schema[column].size, arguments);
+}
+
+static void ignore(void * element) {
+    (void)(element);
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <scale/sequential/stack/sestack.h>
+
+#include <string.h>
+
+#ifndef ASSERT_SEST
+#   include <assert.h>
+#   define ASSERT_SEST assert
+#endif
+
+/// @brief Does nothing, used to destroy stacks of extrema indexes.
+/// @param element Index.
+static void ignore(void * element);
+
+/// @brief Gets index of current extremum.
+/// @param extrema Non-empty stack of extrema indexes.
+/// @return Index of last recorded extremum.
+static size_t last_of(const sstack_s extrema);
+
+/// @brief Records top element's index in minima and maxima if it's strictly past their current extremum.
+/// @param stack Non-empty stack data structure.
+/// @param element_size Size of a single element.
+static void record(sestack_s * stack, const size_t element_size);
+
+sestack_s sest_create(const compare_fn compare) {
+    ASSERT_SEST(compare && "[ERROR] 'compare' parameter is NULL.");
+
+    return (sestack_s) { .stack = sstk_create(), .minima = sstk_create(), .maxima = sstk_create(), .compare = compare, };
+}
+
+void sest_destroy(sestack_s * stack, const destroy_fn destroy, const size_t element_size) {
+    ASSERT_SEST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SEST(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_destroy(&stack->stack, destroy, element_size);
+    sstk_destroy(&stack->minima, ignore, sizeof(size_t));
+    sstk_destroy(&stack->maxima, ignore, sizeof(size_t));
+
+    (*stack) = (sestack_s) { 0 };
+}
+
+bool sest_is_empty(const sestack_s stack) {
+    return sstk_is_empty(stack.stack);
+}
+
+void sest_push(sestack_s * stack, const void * element, const size_t element_size) {
+    ASSERT_SEST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SEST(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_push(&stack->stack, element, element_size);
+    record(stack, element_size);
+}
+
+void sest_push_n(sestack_s * stack, const void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SEST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SEST((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    char const * element = elements;
+    for (size_t i = 0; i < n; ++i) {
+        sstk_push(&stack->stack, element, element_size);
+        record(stack, element_size);
+
+        element += element_size;
+    }
+}
+
+void sest_peep(const sestack_s stack, void * element, const size_t element_size) {
+    sstk_peep(stack.stack, element, element_size);
+}
+
+void sest_pop(sestack_s * stack, void * element, const size_t element_size) {
+    ASSERT_SEST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SEST(stack->stack.size && "[ERROR] Stack is empty.");
+    ASSERT_SEST(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    sstk_pop(&stack->stack, element, element_size);
+
+    size_t index = 0;
+    if (last_of(stack->minima) == stack->stack.size) {
+        sstk_pop(&stack->minima, &index, sizeof(size_t));
+    }
+    if (last_of(stack->maxima) == stack->stack.size) {
+        sstk_pop(&stack->maxima, &index, sizeof(size_t));
+    }
+}
+
+void sest_pop_n(sestack_s * stack, void * elements, const size_t n, const size_t element_size) {
+    ASSERT_SEST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SEST((elements || !n) && "[ERROR] 'elements' parameter is NULL.");
+    ASSERT_SEST(n <= stack->stack.size && "[ERROR] Can't pop more elements than stack has.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    char * element = elements;
+    for (size_t i = 0; i < n; ++i) {
+        sstk_pop(&stack->stack, element, element_size);
+        element += element_size;
+    }
+
+    // only records of popped elements are dropped, records below them still hold for remaining elements
+    size_t index = 0;
+    while (!sstk_is_empty(stack->minima) && last_of(stack->minima) >= stack->stack.size) {
+        sstk_pop(&stack->minima, &index, sizeof(size_t));
+    }
+    while (!sstk_is_empty(stack->maxima) && last_of(stack->maxima) >= stack->stack.size) {
+        sstk_pop(&stack->maxima, &index, sizeof(size_t));
+    }
+}
+
+void sest_minimum(const sestack_s stack, void * element, const size_t element_size) {
+    ASSERT_SEST(stack.stack.size && "[ERROR] Stack is empty.");
+    ASSERT_SEST(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    memcpy(element, (char*)(stack.stack.elements) + (last_of(stack.minima) * element_size), element_size);
+}
+
+void sest_maximum(const sestack_s stack, void * element, const size_t element_size) {
+    ASSERT_SEST(stack.stack.size && "[ERROR] Stack is empty.");
+    ASSERT_SEST(element && "[ERROR] 'element' parameter is NULL.");
+    ASSERT_SEST(element_size && "[ERROR] Element's size can't be zero.");
+
+    memcpy(element, (char*)(stack.stack.elements) + (last_of(stack.maxima) * element_size), element_size);
+}
+
+static void ignore(void * element) {
+    (void)(element);
+}
+
+static size_t last_of(const sstack_s extrema) {
+    return ((size_t*)(extrema.elements))[extrema.size - 1];
+}
+
+static void record(sestack_s * stack, const size_t element_size) {
+    const size_t index = stack->stack.size - 1;
+    if (!index) { // bottom element is both extrema
+        sstk_push(&stack->minima, &index, sizeof(size_t));
+        sstk_push(&stack->maxima, &index, sizeof(size_t));
+        return;
+    }
+
+    char const * elements = stack->stack.elements;
+    char const * top = elements + (index * element_size);
+
+    // equal elements aren't recorded, since lower equal extremum outlives them
+    if (stack->compare(top, elements + (last_of(stack->minima) * element_size)) < 0) {
+        sstk_push(&stack->minima, &index, sizeof(size_t));
+    }
+    if (stack->compare(top, elements + (last_of(stack->maxima) * element_size)) > 0) {
+        sstk_push(&stack->maxima, &index, sizeof(size_t));
+    }
+}
\ No newline at end of file
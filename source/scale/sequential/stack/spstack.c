@@ -0,0 +1,194 @@
+#include <scale/sequential/stack/spstack.h>
+
+#ifndef ASSERT_SPST
+#   include <assert.h>
+#   define ASSERT_SPST assert
+#endif
+
+#if !defined(REALLOC_SPST) && !defined(FREE_SPST)
+#   include <stdlib.h>
+#   ifndef REALLOC_SPST
+#       define REALLOC_SPST realloc
+#   endif
+#   ifndef FREE_SPST
+#       define FREE_SPST free
+#   endif
+#elif !defined(REALLOC_SPST)
+#   error Reallocator macro is not defined!
+#elif !defined(FREE_SPST)
+#   error Free macro is not defined!
+#endif
+
+#if !defined(IS_CAPACITY_SPST) && !defined(EXPAND_CAPACITY_SPST)
+#   ifndef REALLOC_CHUNK_SPST
+#       define REALLOC_CHUNK_SPST (1 << 5)
+#   elif REALLOC_CHUNK_SPST <= 0
+#       error 'REALLOC_CHUNK_SPST' cannot be less than or equal to 0
+#   endif
+#   define IS_CAPACITY_SPST(count) (!((count) % REALLOC_CHUNK_SPST)) // Checks if word count has reached capacity.
+#   define EXPAND_CAPACITY_SPST(capacity) ((capacity) + REALLOC_CHUNK_SPST) // Calculates next stack's word capacity.
+#elif !defined(IS_CAPACITY_SPST)
+#   error Is capacity reached check is not defined.
+#elif !defined(EXPAND_CAPACITY_SPST)
+#   error Expand capacity size is not defined.
+#endif
+
+#define WORD_BITS_SPST (sizeof(uint64_t) * 8) // number of bits in a single word
+#define MASK_SPST(width) (~UINT64_C(0) >> (WORD_BITS_SPST - (width))) // Creates mask of width lowest bits.
+
+/// @brief Copies field into each of word's fields.
+/// @param field Value that fits into width.
+/// @param width Number of bits in a single field.
+/// @return Word with each field set to field.
+static uint64_t replicate(const uint64_t field, const size_t width);
+
+/// @brief Finds fields in word equal to pattern's fields using carries, instead of checking each field.
+/// @param word Word of packed fields.
+/// @param pattern Word with value replicated into each field.
+/// @param low Word with each field's bits set, except for its highest one.
+/// @param high Word with only each field's highest bit set.
+/// @return Word with only highest bit of each equal field set.
+static uint64_t equal(const uint64_t word, const uint64_t pattern, const uint64_t low, const uint64_t high);
+
+spstack_s spst_create(const size_t width) {
+    ASSERT_SPST(width && width <= WORD_BITS_SPST && "[ERROR] Value's width must be from 1 to 64 bits.");
+
+    return (spstack_s) { .width = width, };
+}
+
+void spst_destroy(spstack_s * stack) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+
+    FREE_SPST(stack->words);
+    (*stack) = (spstack_s) { 0 };
+}
+
+bool spst_is_empty(const spstack_s stack) {
+    return !(stack.size);
+}
+
+void spst_push(spstack_s * stack, const uint64_t value) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SPST((~stack->size) && "[ERROR] Stack size variable will overflow.");
+    ASSERT_SPST(!(value & ~MASK_SPST(stack->width)) && "[ERROR] Value doesn't fit into stack's width.");
+
+    const size_t per_word = WORD_BITS_SPST / stack->width;
+    const size_t word = stack->size / per_word, shift = (stack->size % per_word) * stack->width;
+
+    if (!shift) { // value starts a new word
+        if (IS_CAPACITY_SPST(word)) {
+            const size_t expand = EXPAND_CAPACITY_SPST(word);
+
+            stack->words = REALLOC_SPST(stack->words, expand * sizeof(uint64_t));
+            ASSERT_SPST(stack->words && "[ERROR] Memory allocation failed.");
+        }
+        stack->words[word] = 0;
+    }
+
+    stack->words[word] |= value << shift;
+    stack->size++;
+}
+
+uint64_t spst_peep(const spstack_s stack) {
+    ASSERT_SPST(stack.size && "[ERROR] Stack is empty.");
+
+    const size_t per_word = WORD_BITS_SPST / stack.width;
+    const size_t word = (stack.size - 1) / per_word, shift = ((stack.size - 1) % per_word) * stack.width;
+
+    return (stack.words[word] >> shift) & MASK_SPST(stack.width);
+}
+
+uint64_t spst_pop(spstack_s * stack) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SPST(stack->size && "[ERROR] Stack is empty.");
+
+    stack->size--;
+    const size_t per_word = WORD_BITS_SPST / stack->width;
+    const size_t word = stack->size / per_word, shift = (stack->size % per_word) * stack->width;
+
+    const uint64_t value = (stack->words[word] >> shift) & MASK_SPST(stack->width);
+    stack->words[word] &= ~(MASK_SPST(stack->width) << shift); // keep unused bits zero for word at a time scans
+
+    if (!shift && IS_CAPACITY_SPST(word)) { // popped value was the only one in its word
+        if (word) {
+            stack->words = REALLOC_SPST(stack->words, word * sizeof(uint64_t));
+        } else {
+            FREE_SPST(stack->words);
+            stack->words = NULL;
+        }
+    }
+
+    return value;
+}
+
+size_t spst_count(spstack_s const * stack, const uint64_t value) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SPST(!(value & ~MASK_SPST(stack->width)) && "[ERROR] Value doesn't fit into stack's width.");
+
+    const size_t per_word = WORD_BITS_SPST / stack->width;
+    const size_t full = stack->size / per_word, rest = stack->size % per_word;
+
+    const uint64_t pattern = replicate(value, stack->width);
+    const uint64_t low = replicate(MASK_SPST(stack->width) >> 1, stack->width);
+    const uint64_t high = replicate(UINT64_C(1) << (stack->width - 1), stack->width);
+
+    size_t count = 0;
+    for (size_t i = 0; i < full; ++i) {
+        count += (size_t)__builtin_popcountll(equal(stack->words[i], pattern, low, high));
+    }
+    if (rest) { // only count fields of last word that hold values
+        const uint64_t used = MASK_SPST(rest * stack->width);
+        count += (size_t)__builtin_popcountll(equal(stack->words[full], pattern, low, high) & used);
+    }
+
+    return count;
+}
+
+size_t spst_find(spstack_s const * stack, const uint64_t value) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SPST(!(value & ~MASK_SPST(stack->width)) && "[ERROR] Value doesn't fit into stack's width.");
+
+    const size_t per_word = WORD_BITS_SPST / stack->width;
+    const size_t rest = stack->size % per_word;
+
+    const uint64_t pattern = replicate(value, stack->width);
+    const uint64_t low = replicate(MASK_SPST(stack->width) >> 1, stack->width);
+    const uint64_t high = replicate(UINT64_C(1) << (stack->width - 1), stack->width);
+
+    for (size_t i = (stack->size + per_word - 1) / per_word; i > 0; --i) {
+        uint64_t found = equal(stack->words[i - 1], pattern, low, high);
+        if (i * per_word > stack->size) { // only check fields of last word that hold values
+            found &= MASK_SPST(rest * stack->width);
+        }
+
+        if (found) {
+            const size_t field = (WORD_BITS_SPST - 1 - (size_t)__builtin_clzll(found)) / stack->width;
+            return stack->size - 1 - (((i - 1) * per_word) + field);
+        }
+    }
+
+    return stack->size;
+}
+
+void spst_map(spstack_s const * stack, const manage_fn manage, void * arguments) {
+    ASSERT_SPST(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SPST(manage && "[ERROR] 'manage' parameter is NULL.");
+
+    const size_t per_word = WORD_BITS_SPST / stack->width;
+    manage(stack->words, (stack->size + per_word - 1) / per_word, sizeof(uint64_t), arguments);
+}
+
+static uint64_t replicate(const uint64_t field, const size_t width) {
+    uint64_t word = 0;
+    for (size_t shift = 0; shift + width <= WORD_BITS_SPST; shift += width) {
+        word |= field << shift;
+    }
+    return word;
+}
+
+static uint64_t equal(const uint64_t word, const uint64_t pattern, const uint64_t low, const uint64_t high) {
+    const uint64_t difference = word ^ pattern; // equal fields become zero
+    // adding low bits carries into field's highest bit if any of its low bits is set, without crossing fields
+    const uint64_t nonzero = ((difference & low) + low) | difference;
+    return ~nonzero & high;
+}
\ No newline at end of file
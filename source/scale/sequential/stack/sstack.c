@@ -1,4 +1,5 @@
 #include <scale/sequential/stack/sstack.h>
+#include "../parallel.h"
 
 #include <string.h>
 
@@ -149,3 +150,17 @@ void sstk_map(sstack_s const * stack, const manage_fn manage, const size_t eleme
 
     manage(stack->elements, stack->size, element_size, arguments);
 }
+
+void sstk_map_parallel(sstack_s const * stack, const manage_fn manage, const merge_fn merge, const size_t thread_count, const size_t element_size, void * arguments) {
+    ASSERT_SSTK(stack && "[ERROR] 'stack' parameter is NULL.");
+    ASSERT_SSTK(manage && "[ERROR] 'manage' parameter is NULL.");
+    ASSERT_SSTK(thread_count && "[ERROR] Thread count can't be zero.");
+    ASSERT_SSTK(element_size && "[ERROR] Element's size can't be zero.");
+
+    const size_t scratch_size = parallel_map_scratch(stack->size, thread_count);
+    void * scratch = scratch_size ? REALLOC_SSTK(NULL, scratch_size) : NULL;
+    ASSERT_SSTK((scratch || !scratch_size) && "[ERROR] Memory allocation failed.");
+
+    parallel_map(stack->elements, stack->size, manage, merge, thread_count, element_size, arguments, scratch);
+    FREE_SSTK(scratch);
+}
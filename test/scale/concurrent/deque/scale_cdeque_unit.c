@@ -0,0 +1,200 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/deque/cdeque.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define THIEF_COUNT 3
+#define THREADED_COUNT (1 << 14)
+
+TEST CREATE_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected deque to be empty.", cdeq_is_empty(&test));
+    ASSERT_NEQm("[IRS-ERROR] Test deque array is NULL.", NULL, test.array);
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test deque array is not NULL.", NULL, test.array);
+
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    cdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    ASSERT_FALSEm("[IRS-ERROR] Expected deque to not be empty.", cdeq_is_empty(&test));
+
+    DATA_TYPE b = 0;
+    ASSERTm("[IRS-ERROR] Expected element to be dequeued.", cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_02(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK - 1; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected owner to dequeue in LIFO order.", i, b);
+    }
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_03(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+
+    // steal some elements so that growth has to copy a wrapped circular array
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        DATA_TYPE b = 0;
+        cdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+    }
+    for (int i = REALLOC_CHUNK; i < (REALLOC_CHUNK << 1) + 1; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK >> 1; i < (REALLOC_CHUNK << 1) + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be stolen.", cdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected thief to dequeue in FIFO order.", i, b);
+    }
+    ASSERTm("[IRS-ERROR] Expected deque to be empty.", cdeq_is_empty(&test));
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_FRONT_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not dequeue.", cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected deque to stay empty.", cdeq_is_empty(&test));
+
+    const DATA_TYPE a = 42;
+    cdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be dequeued.", cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_REAR_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not be stolen from.", cdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE)));
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_REAR_02(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        cdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected thief to dequeue in FIFO order.", i, b);
+    }
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT];
+static bool is_owner_done;
+
+static void * steal(void * deque) {
+    while (!__atomic_load_n(&is_owner_done, __ATOMIC_ACQUIRE) || !cdeq_is_empty(deque)) {
+        DATA_TYPE b = 0;
+        if (cdeq_dequeue_rear(deque, &b, sizeof(DATA_TYPE))) {
+            __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+        } else {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    cdeque_s test = cdeq_create(sizeof(DATA_TYPE));
+    is_owner_done = false;
+
+    pthread_t thieves[THIEF_COUNT];
+    for (size_t i = 0; i < THIEF_COUNT; ++i) {
+        pthread_create(&thieves[i], NULL, steal, &test);
+    }
+
+    // owner pushes batches and pops half of each batch back while thieves steal
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        cdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+        if (i & 1) {
+            DATA_TYPE b = 0;
+            if (cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE))) {
+                __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+            }
+        }
+    }
+    for (DATA_TYPE b = 0; cdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));) {
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&is_owner_done, true, __ATOMIC_RELEASE);
+
+    for (size_t i = 0; i < THIEF_COUNT; ++i) {
+        pthread_join(thieves[i], NULL);
+    }
+
+    for (size_t i = 0; i < THREADED_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be taken exactly once.", 1, taken[i]);
+    }
+
+    cdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_cdeque_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue front
+    RUN_TEST(ENQUEUE_FRONT_01); RUN_TEST(ENQUEUE_FRONT_02); RUN_TEST(ENQUEUE_FRONT_03);
+    // dequeue front
+    RUN_TEST(DEQUEUE_FRONT_01);
+    // dequeue rear
+    RUN_TEST(DEQUEUE_REAR_01); RUN_TEST(DEQUEUE_REAR_02);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/deque/fcdeque.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 12)
+
+TEST CREATE_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    ASSERTm("[IRS-ERROR] Expected deque to be empty.", sdeq_is_empty(test.deque));
+    ASSERT_NEQm("[IRS-ERROR] Test deque requests are NULL.", NULL, test.requests);
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    fcdeque_s test = fcdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test deque requests are not NULL.", NULL, test.requests);
+    ASSERT_EQm("[IRS-ERROR] Test deque elements are not NULL.", NULL, test.deque.elements);
+
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_01(void) {
+    fcdeque_s test = fcdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", fcdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue front in LIFO order.", i, b);
+    }
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_REAR_01(void) {
+    fcdeque_s test = fcdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", fcdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue front in FIFO order.", i, b);
+    }
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_FRONT_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not peek.", fcdeq_peek_front(&test, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42, c = 24;
+    fcdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    fcdeq_enqueue_rear(&test, &c, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be peeked.", fcdeq_peek_front(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek 42.", 42, b);
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_REAR_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not peek.", fcdeq_peek_rear(&test, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42, c = 24;
+    fcdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    fcdeq_enqueue_rear(&test, &c, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be peeked.", fcdeq_peek_rear(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek 24.", 24, b);
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_FRONT_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not dequeue.", fcdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE)));
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_REAR_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty deque to not dequeue.", fcdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", fcdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue rear in FIFO order.", i, b);
+    }
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    fcdeque_s * deque;
+    int start;
+};
+
+static void * enqueue_dequeue(void * arg) {
+    const struct threaded_arg * threaded = arg;
+
+    // threads alternate ends, so that elements cross between front and rear operations
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        if (i & 1) {
+            fcdeq_enqueue_front(threaded->deque, &i, sizeof(DATA_TYPE));
+        } else {
+            fcdeq_enqueue_rear(threaded->deque, &i, sizeof(DATA_TYPE));
+        }
+
+        DATA_TYPE b = 0;
+        const bool is_front = (threaded->start / THREADED_COUNT) & 1;
+        while (!(is_front ? fcdeq_dequeue_front(threaded->deque, &b, sizeof(DATA_TYPE)) : fcdeq_dequeue_rear(threaded->deque, &b, sizeof(DATA_TYPE)))) {
+            sched_yield();
+        }
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    fcdeque_s test = fcdeq_create();
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .deque = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, enqueue_dequeue, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected deque to be empty.", sdeq_is_empty(test.deque));
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued exactly once.", 1, taken[i]);
+    }
+
+    fcdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_fcdeque_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue front
+    RUN_TEST(ENQUEUE_FRONT_01);
+    // enqueue rear
+    RUN_TEST(ENQUEUE_REAR_01);
+    // peek front
+    RUN_TEST(PEEK_FRONT_01);
+    // peek rear
+    RUN_TEST(PEEK_REAR_01);
+    // dequeue front
+    RUN_TEST(DEQUEUE_FRONT_01);
+    // dequeue rear
+    RUN_TEST(DEQUEUE_REAR_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "unit.h"
+
+GREATEST_MAIN_DEFS();
+
+int main(const int argc, char **argv) {
+    GREATEST_MAIN_BEGIN();
+
+    RUN_SUITE(scale_spsc_queue_unit_test);
+    RUN_SUITE(scale_mpmc_queue_unit_test);
+    RUN_SUITE(scale_fcqueue_unit_test);
+    RUN_SUITE(scale_bqueue_unit_test);
+    RUN_SUITE(scale_mqueue_unit_test);
+    RUN_SUITE(scale_shmqueue_unit_test);
+    RUN_SUITE(scale_evqueue_unit_test);
+    RUN_SUITE(scale_cdeque_unit_test);
+    RUN_SUITE(scale_fcdeque_unit_test);
+    RUN_SUITE(scale_cstack_unit_test);
+    RUN_SUITE(scale_fcstack_unit_test);
+    RUN_SUITE(scale_mpool_unit_test);
+    RUN_SUITE(scale_tpool_unit_test);
+
+    GREATEST_MAIN_END();
+}
\ No newline at end of file
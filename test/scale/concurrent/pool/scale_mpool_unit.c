@@ -0,0 +1,162 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/pool/mpool.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#define MAGAZINE_SIZE 8
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 12)
+
+TEST CREATE_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+
+    ASSERTm("[IRS-ERROR] Expected depot to be empty.", sstk_is_empty(test.depot));
+    ASSERT_EQm("[IRS-ERROR] Expected magazine size to be set.", MAGAZINE_SIZE, test.magazine_size);
+
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+    mpool_cache_s cache = mpool_cache_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        mpool_put(&test, &cache, &i, sizeof(DATA_TYPE));
+    }
+    mpool_cache_destroy(&test, &cache, sizeof(DATA_TYPE));
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test depot elements are not NULL.", NULL, test.depot.elements);
+
+    PASS();
+}
+
+TEST GET_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+    mpool_cache_s cache = mpool_cache_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty pool to not get.", mpool_get(&test, &cache, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42;
+    mpool_put(&test, &cache, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be gotten.", mpool_get(&test, &cache, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to get 42.", 42, b);
+
+    mpool_cache_destroy(&test, &cache, sizeof(DATA_TYPE));
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUT_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+    mpool_cache_s cache = mpool_cache_create();
+
+    // two magazines stay in cache, every further full magazine moves to depot
+    for (int i = 0; i < MAGAZINE_SIZE * 4; ++i) {
+        mpool_put(&test, &cache, &i, sizeof(DATA_TYPE));
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected two full magazines in depot.", 2, test.depot.size);
+
+    for (int i = MAGAZINE_SIZE * 4 - 1; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be gotten.", mpool_get(&test, &cache, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to get in LIFO order.", i, b);
+    }
+    ASSERTm("[IRS-ERROR] Expected depot to be empty.", sstk_is_empty(test.depot));
+
+    mpool_cache_destroy(&test, &cache, sizeof(DATA_TYPE));
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CACHE_DESTROY_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+    mpool_cache_s first = mpool_cache_create();
+    for (int i = 0; i < MAGAZINE_SIZE + 1; ++i) {
+        mpool_put(&test, &first, &i, sizeof(DATA_TYPE));
+    }
+    mpool_cache_destroy(&test, &first, sizeof(DATA_TYPE));
+
+    int count = 0;
+    mpool_cache_s second = mpool_cache_create();
+    for (DATA_TYPE b = 0; mpool_get(&test, &second, &b, sizeof(DATA_TYPE)); ++count) {}
+    ASSERT_EQm("[IRS-ERROR] Expected other cache to get every returned element.", MAGAZINE_SIZE + 1, count);
+
+    mpool_cache_destroy(&test, &second, sizeof(DATA_TYPE));
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    mpool_s * pool;
+    int start;
+};
+
+static void * put_get(void * arg) {
+    const struct threaded_arg * threaded = arg;
+    mpool_cache_s cache = mpool_cache_create();
+
+    // each thread puts its own range, then gets the same number back, possibly elements of other threads
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        mpool_put(threaded->pool, &cache, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = 0; i < THREADED_COUNT >> 1; ++i) {
+        DATA_TYPE b = 0;
+        if (mpool_get(threaded->pool, &cache, &b, sizeof(DATA_TYPE))) {
+            __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    mpool_cache_destroy(threaded->pool, &cache, sizeof(DATA_TYPE));
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    mpool_s test = mpool_create(MAGAZINE_SIZE);
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .pool = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, put_get, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    mpool_cache_s cache = mpool_cache_create();
+    for (DATA_TYPE b = 0; mpool_get(&test, &cache, &b, sizeof(DATA_TYPE));) {
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+    mpool_cache_destroy(&test, &cache, sizeof(DATA_TYPE));
+
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be gotten exactly once.", 1, taken[i]);
+    }
+
+    mpool_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_mpool_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // get
+    RUN_TEST(GET_01);
+    // put
+    RUN_TEST(PUT_01);
+    // cache destroy
+    RUN_TEST(CACHE_DESTROY_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
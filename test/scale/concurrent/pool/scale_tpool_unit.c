@@ -0,0 +1,140 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/pool/tpool.h>
+
+#include <stdlib.h>
+
+#define WORKER_COUNT 3
+#define THREADED_COUNT (1 << 12)
+
+static tpool_s pool;
+
+TEST CREATE_01(void) {
+    tpool_s test = tpool_create(WORKER_COUNT);
+
+    ASSERT_NEQm("[IRS-ERROR] Test pool runtime is NULL.", NULL, test.runtime);
+    ASSERT_EQm("[IRS-ERROR] Expected worker count to be set.", WORKER_COUNT, test.worker_count);
+
+    tpool_destroy(&test);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    tpool_s test = tpool_create(WORKER_COUNT);
+    tpool_destroy(&test);
+
+    ASSERT_EQm("[IRS-ERROR] Test pool runtime is not NULL.", NULL, test.runtime);
+
+    PASS();
+}
+
+static void add_one(void * counter) {
+    __atomic_fetch_add((int*)counter, 1, __ATOMIC_RELAXED);
+}
+
+TEST SPAWN_01(void) {
+    pool = tpool_create(WORKER_COUNT);
+
+    int counter = 0;
+    tpool_group_s group = tpool_group_create();
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        tpool_spawn(pool, &group, add_one, &counter);
+    }
+    tpool_wait(pool, &group);
+
+    ASSERT_EQm("[IRS-ERROR] Expected every spawned task to run once.", THREADED_COUNT, counter);
+    ASSERT_EQm("[IRS-ERROR] Expected group to have no pending tasks.", 0, group.pending);
+
+    tpool_destroy(&pool);
+    PASS();
+}
+
+struct fibonacci {
+    int n;
+    long result;
+};
+
+static void fibonacci(void * argument) {
+    struct fibonacci * fib = argument;
+    if (fib->n < 2) {
+        fib->result = fib->n;
+        return;
+    }
+
+    // fork one half onto own deque, compute other half, then join helping with stolen work
+    struct fibonacci left = { .n = fib->n - 1, }, right = { .n = fib->n - 2, };
+    tpool_group_s group = tpool_group_create();
+    tpool_spawn(pool, &group, fibonacci, &left);
+    fibonacci(&right);
+    tpool_wait(pool, &group);
+
+    fib->result = left.result + right.result;
+}
+
+TEST SPAWN_02(void) {
+    pool = tpool_create(WORKER_COUNT);
+
+    struct fibonacci fib = { .n = 20, };
+    tpool_group_s group = tpool_group_create();
+    tpool_spawn(pool, &group, fibonacci, &fib);
+    tpool_wait(pool, &group);
+
+    ASSERT_EQm("[IRS-ERROR] Expected 20th fibonacci number.", 6765, fib.result);
+
+    tpool_destroy(&pool);
+    PASS();
+}
+
+static void fill(size_t begin, size_t end, void * argument) {
+    int * elements = argument;
+    for (size_t i = begin; i < end; ++i) {
+        elements[i]++;
+    }
+}
+
+TEST PARALLEL_FOR_01(void) {
+    pool = tpool_create(WORKER_COUNT);
+
+    int * elements = calloc(THREADED_COUNT, sizeof(int));
+    tpool_parallel_for(pool, 0, THREADED_COUNT, REALLOC_CHUNK - 1, fill, elements);
+
+    for (size_t i = 0; i < THREADED_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each iteration to run exactly once.", 1, elements[i]);
+    }
+
+    free(elements);
+    tpool_destroy(&pool);
+    PASS();
+}
+
+TEST PARALLEL_FOR_02(void) {
+    pool = tpool_create(WORKER_COUNT);
+
+    int elements[REALLOC_CHUNK] = { 0 };
+    tpool_parallel_for(pool, REALLOC_CHUNK, REALLOC_CHUNK, 1, fill, elements);
+    for (size_t i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected empty range to not run.", 0, elements[i]);
+    }
+
+    tpool_parallel_for(pool, 1, REALLOC_CHUNK, REALLOC_CHUNK << 1, fill, elements);
+    ASSERT_EQm("[IRS-ERROR] Expected iteration before range to not run.", 0, elements[0]);
+    for (size_t i = 1; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected single chunk to run each iteration.", 1, elements[i]);
+    }
+
+    tpool_destroy(&pool);
+    PASS();
+}
+
+SUITE (scale_tpool_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // spawn
+    RUN_TEST(SPAWN_01); RUN_TEST(SPAWN_02);
+    // parallel for
+    RUN_TEST(PARALLEL_FOR_01); RUN_TEST(PARALLEL_FOR_02);
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/bqueue.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#define CONSUMER_COUNT 3
+#define THREADED_COUNT (1 << 12)
+#define MILLISECOND 1000000
+
+TEST CREATE_01(void) {
+    bqueue_s test = bque_create();
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", sque_is_empty(test.queue));
+    ASSERT_FALSEm("[IRS-ERROR] Expected queue to be open.", test.closed);
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    bqueue_s test = bque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        bque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue elements are not NULL.", NULL, test.queue.elements);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    bqueue_s test = bque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be enqueued.", bque_enqueue(&test, &i, sizeof(DATA_TYPE)));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", bque_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue in FIFO order.", i, b);
+    }
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_DEQUEUE_01(void) {
+    bqueue_s test = bque_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not dequeue.", bque_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_WAIT_01(void) {
+    bqueue_s test = bque_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected wait on empty queue to time out.", bque_dequeue_wait(&test, &b, MILLISECOND, sizeof(DATA_TYPE)));
+    ASSERT_FALSEm("[IRS-ERROR] Expected zero timeout to not wait.", bque_dequeue_wait(&test, &b, 0, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected no waiters after timeout.", 0, test.waiters);
+
+    const DATA_TYPE a = 42;
+    bque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be dequeued.", bque_dequeue_wait(&test, &b, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_BATCH_WAIT_01(void) {
+    bqueue_s test = bque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        bque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE b[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 'max' elements.", REALLOC_CHUNK, bque_dequeue_batch_wait(&test, b, REALLOC_CHUNK, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue in FIFO order.", i, b[i]);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue remaining element.", 1, bque_dequeue_batch_wait(&test, b, REALLOC_CHUNK, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue last element.", REALLOC_CHUNK, b[0]);
+    ASSERT_EQm("[IRS-ERROR] Expected wait on empty queue to time out.", 0, bque_dequeue_batch_wait(&test, b, REALLOC_CHUNK, MILLISECOND, sizeof(DATA_TYPE)));
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CLOSE_01(void) {
+    bqueue_s test = bque_create();
+
+    const DATA_TYPE a = 42;
+    bque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    bque_close(&test);
+    ASSERT_FALSEm("[IRS-ERROR] Expected closed queue to not enqueue.", bque_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    DATA_TYPE b = 0;
+    ASSERTm("[IRS-ERROR] Expected closed queue to drain remaining element.", bque_dequeue_wait(&test, &b, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+    ASSERT_FALSEm("[IRS-ERROR] Expected drained closed queue to not wait.", bque_dequeue_wait(&test, &b, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT];
+
+static void * consume(void * queue) {
+    DATA_TYPE b[REALLOC_CHUNK] = { 0 };
+    for (size_t count = 0; (count = bque_dequeue_batch_wait(queue, b, REALLOC_CHUNK, WAIT_FOREVER_BQUE, sizeof(DATA_TYPE)));) {
+        for (size_t i = 0; i < count; ++i) {
+            __atomic_fetch_add(&taken[b[i]], 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    bqueue_s test = bque_create();
+
+    pthread_t consumers[CONSUMER_COUNT];
+    for (size_t i = 0; i < CONSUMER_COUNT; ++i) {
+        pthread_create(&consumers[i], NULL, consume, &test);
+    }
+
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        bque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    bque_close(&test);
+
+    for (size_t i = 0; i < CONSUMER_COUNT; ++i) {
+        pthread_join(consumers[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected queue to be drained.", sque_is_empty(test.queue));
+    for (size_t i = 0; i < THREADED_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued exactly once.", 1, taken[i]);
+    }
+
+    bque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_bqueue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // try dequeue
+    RUN_TEST(TRY_DEQUEUE_01);
+    // dequeue wait
+    RUN_TEST(DEQUEUE_WAIT_01);
+    // dequeue batch wait
+    RUN_TEST(DEQUEUE_BATCH_WAIT_01);
+    // close
+    RUN_TEST(CLOSE_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
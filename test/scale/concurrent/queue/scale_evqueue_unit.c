@@ -0,0 +1,179 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/evqueue.h>
+
+#include <stdint.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define THREADED_COUNT (1 << 14)
+
+/// Checks without waiting if queue's descriptor is readable.
+static bool is_readable(evqueue_s const * queue) {
+    struct pollfd descriptor = { .fd = queue->descriptor, .events = POLLIN, };
+    return 1 == poll(&descriptor, 1, 0) && (descriptor.revents & POLLIN);
+}
+
+TEST CREATE_01(void) {
+    evqueue_s test = evque_create();
+
+    ASSERT_NEQm("[IRS-ERROR] Test queue descriptor is '-1'.", -1, test.descriptor);
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", evque_is_empty(&test));
+    ASSERT_FALSEm("[IRS-ERROR] Expected descriptor to not be readable.", is_readable(&test));
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    evqueue_s test = evque_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        evque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue descriptor is not '-1'.", -1, test.descriptor);
+    ASSERT_EQm("[IRS-ERROR] Test queue size is not zero.", 0, test.queue.size);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    evqueue_s test = evque_create();
+
+    const DATA_TYPE a = 42;
+    evque_enqueue(&test, &a, sizeof(DATA_TYPE));
+
+    ASSERT_FALSEm("[IRS-ERROR] Expected queue to not be empty.", evque_is_empty(&test));
+    ASSERTm("[IRS-ERROR] Expected descriptor to be readable.", is_readable(&test));
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_02(void) {
+    evqueue_s test = evque_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        evque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+#ifdef __linux__
+    // only empty to non-empty transition signals, so the eventfd counter holds a single increment
+    uint64_t counter = 0;
+    ASSERT_EQm("[IRS-ERROR] Expected to read eventfd counter.", (long)sizeof(counter), (long)read(test.descriptor, &counter, sizeof(counter)));
+    ASSERT_EQm("[IRS-ERROR] Expected a single signal.", 1, counter);
+#else
+    // only empty to non-empty transition signals, so the self-pipe holds a single byte
+    char bytes[2] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected a single signal.", 1L, (long)read(test.descriptor, bytes, sizeof(bytes)));
+#endif
+
+    test.is_signaled = false; // signal was consumed by test instead of queue
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_N_01(void) {
+    evqueue_s test = evque_create();
+
+    DATA_TYPE elements[REALLOC_CHUNK] = { 0 };
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        elements[i] = i;
+    }
+    evque_enqueue_n(&test, elements, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected descriptor to be readable.", is_readable(&test));
+
+    DATA_TYPE buffer[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue every element.", REALLOC_CHUNK, evque_dequeue_batch(&test, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, buffer[i]);
+    }
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_BATCH_01(void) {
+    evqueue_s test = evque_create();
+
+    DATA_TYPE buffer[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected empty queue to dequeue nothing.", 0, evque_dequeue_batch(&test, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_BATCH_02(void) {
+    evqueue_s test = evque_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        evque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE buffer[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue half.", REALLOC_CHUNK / 2, evque_dequeue_batch(&test, buffer, REALLOC_CHUNK / 2, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected descriptor to stay readable while elements remain.", is_readable(&test));
+
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue remaining half.", REALLOC_CHUNK / 2, evque_dequeue_batch(&test, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    for (int i = 0; i < REALLOC_CHUNK / 2; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i + (REALLOC_CHUNK / 2), buffer[i]);
+    }
+    ASSERT_FALSEm("[IRS-ERROR] Expected drained descriptor to not be readable.", is_readable(&test));
+
+    const DATA_TYPE a = 42;
+    evque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected descriptor to be readable again.", is_readable(&test));
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static void * produce(void * queue) {
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        evque_enqueue(queue, &i, sizeof(DATA_TYPE));
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    evqueue_s test = evque_create();
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, produce, &test);
+
+    DATA_TYPE buffer[REALLOC_CHUNK] = { 0 };
+    struct pollfd descriptor = { .fd = test.descriptor, .events = POLLIN, };
+    for (int expected = 0; expected < THREADED_COUNT;) {
+        ASSERT_EQm("[IRS-ERROR] Expected poll to report descriptor.", 1, poll(&descriptor, 1, -1));
+
+        const size_t n = evque_dequeue_batch(&test, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE));
+        for (size_t i = 0; i < n; ++i, ++expected) {
+            ASSERT_EQm("[IRS-ERROR] Expected to dequeue elements in order.", expected, buffer[i]);
+        }
+    }
+
+    pthread_join(producer, NULL);
+    ASSERT_FALSEm("[IRS-ERROR] Expected drained descriptor to not be readable.", is_readable(&test));
+
+    evque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_evqueue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01); RUN_TEST(ENQUEUE_02);
+    // enqueue n
+    RUN_TEST(ENQUEUE_N_01);
+    // dequeue batch
+    RUN_TEST(DEQUEUE_BATCH_01); RUN_TEST(DEQUEUE_BATCH_02);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/fcqueue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 12)
+
+TEST CREATE_01(void) {
+    fcqueue_s test = fcque_create();
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", sque_is_empty(test.queue));
+    ASSERT_NEQm("[IRS-ERROR] Test queue requests are NULL.", NULL, test.requests);
+
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    fcqueue_s test = fcque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue requests are not NULL.", NULL, test.requests);
+    ASSERT_EQm("[IRS-ERROR] Test queue elements are not NULL.", NULL, test.queue.elements);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    fcqueue_s test = fcque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", fcque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue in FIFO order.", i, b);
+    }
+
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_01(void) {
+    fcqueue_s test = fcque_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not peek.", fcque_peek(&test, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42;
+    fcque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be peeked.", fcque_peek(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek 42.", 42, b);
+    ASSERT_FALSEm("[IRS-ERROR] Expected queue to not be empty.", sque_is_empty(test.queue));
+
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    fcqueue_s test = fcque_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not dequeue.", fcque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    fcqueue_s * queue;
+    int start;
+};
+
+static void * enqueue_dequeue(void * arg) {
+    const struct threaded_arg * threaded = arg;
+
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        fcque_enqueue(threaded->queue, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = 0;
+        while (!fcque_dequeue(threaded->queue, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    fcqueue_s test = fcque_create();
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .queue = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, enqueue_dequeue, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", sque_is_empty(test.queue));
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued exactly once.", 1, taken[i]);
+    }
+
+    fcque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_fcqueue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // peek
+    RUN_TEST(PEEK_01);
+    // dequeue
+    RUN_TEST(DEQUEUE_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/mpmcqueue.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 14)
+
+TEST CREATE_01(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not REALLOC_CHUNK.", REALLOC_CHUNK, test.capacity);
+    ASSERT_NEQm("[IRS-ERROR] Test queue slots is NULL.", NULL, test.slots);
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CREATE_02(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK - 1, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not rounded to power of two.", REALLOC_CHUNK, test.capacity);
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        mpmc_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not zero.", 0, test.capacity);
+    ASSERT_EQm("[IRS-ERROR] Test queue slots is not NULL.", NULL, test.slots);
+
+    PASS();
+}
+
+TEST TRY_ENQUEUE_01(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    ASSERTm("[IRS-ERROR] Expected element to be enqueued.", mpmc_try_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    DATA_TYPE b = 0;
+    ASSERTm("[IRS-ERROR] Expected element to be dequeued.", mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_ENQUEUE_02(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be enqueued.", mpmc_try_enqueue(&test, &i, sizeof(DATA_TYPE)));
+    }
+
+    const DATA_TYPE a = 42;
+    ASSERT_FALSEm("[IRS-ERROR] Expected full queue to reject element.", mpmc_try_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_ENQUEUE_03(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    // cycle through slots more than once so sequence numbers advance to next laps
+    for (int i = 0; i < REALLOC_CHUNK * 3; ++i) {
+        mpmc_try_enqueue(&test, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = 0;
+        mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_ENQUEUE_04(void) {
+    mpmcqueue_s test = mpmc_create(1, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected capacity of one to be rounded up to two.", 2, test.capacity);
+
+    // single slot would take next lap's sequence as free, so a full queue would overwrite and then livelock dequeues
+    for (int i = 0; i < 2; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be enqueued.", mpmc_try_enqueue(&test, &i, sizeof(DATA_TYPE)));
+    }
+    const DATA_TYPE a = 42;
+    ASSERT_FALSEm("[IRS-ERROR] Expected full queue to reject element.", mpmc_try_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < 2; ++i) {
+        DATA_TYPE b = -1;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected drained queue to not dequeue.", mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_DEQUEUE_01(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not dequeue.", mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST TRY_DEQUEUE_02(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    mpmc_try_enqueue(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE));
+    ASSERT_FALSEm("[IRS-ERROR] Expected drained queue to not dequeue.", mpmc_try_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static void * produce(void * queue) {
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        mpmc_enqueue(queue, &i, sizeof(DATA_TYPE));
+    }
+
+    return NULL;
+}
+
+static void * consume(void * queue) {
+    int * counts = calloc(THREADED_COUNT, sizeof(int));
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        DATA_TYPE b = 0;
+        mpmc_dequeue(queue, &b, sizeof(DATA_TYPE));
+        counts[b]++;
+    }
+
+    return counts;
+}
+
+TEST THREADED_01(void) {
+    mpmcqueue_s test = mpmc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    pthread_t producers[THREAD_COUNT], consumers[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_create(&producers[i], NULL, produce, &test);
+        pthread_create(&consumers[i], NULL, consume, &test);
+    }
+
+    int totals[THREADED_COUNT] = { 0 };
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(producers[i], NULL);
+
+        int * counts = NULL;
+        pthread_join(consumers[i], (void**)&counts);
+        for (size_t j = 0; j < THREADED_COUNT; ++j) {
+            totals[j] += counts[j];
+        }
+        free(counts);
+    }
+
+    for (size_t j = 0; j < THREADED_COUNT; ++j) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued once per producer.", THREAD_COUNT, totals[j]);
+    }
+
+    mpmc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_mpmc_queue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_02);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // try enqueue
+    RUN_TEST(TRY_ENQUEUE_01); RUN_TEST(TRY_ENQUEUE_02); RUN_TEST(TRY_ENQUEUE_03); RUN_TEST(TRY_ENQUEUE_04);
+    // try dequeue
+    RUN_TEST(TRY_DEQUEUE_01); RUN_TEST(TRY_DEQUEUE_02);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
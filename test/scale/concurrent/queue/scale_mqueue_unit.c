@@ -0,0 +1,149 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/mqueue.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define SHARD_COUNT 4
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 12)
+
+TEST CREATE_01(void) {
+    mqueue_s test = mque_create(SHARD_COUNT, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", mque_is_empty(&test));
+    ASSERT_NEQm("[IRS-ERROR] Test queue shards are NULL.", NULL, test.shards);
+    ASSERT_EQm("[IRS-ERROR] Expected shard count to be set.", SHARD_COUNT, test.shard_count);
+
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    mqueue_s test = mque_create(SHARD_COUNT, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        mque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue shards are not NULL.", NULL, test.shards);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    mqueue_s test = mque_create(1, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        mque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    // a single shard keeps strict FIFO order
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", mque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue in FIFO order.", i, b);
+    }
+
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_02(void) {
+    mqueue_s test = mque_create(SHARD_COUNT, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        mque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int taken[REALLOC_CHUNK + 1] = { 0 };
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be dequeued.", mque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+        taken[b]++;
+    }
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", mque_is_empty(&test));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued exactly once.", 1, taken[i]);
+    }
+
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    mqueue_s test = mque_create(SHARD_COUNT, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not dequeue.", mque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42;
+    mque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected single element to be found in any shard.", mque_dequeue(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    mqueue_s * queue;
+    int start;
+};
+
+static void * enqueue_dequeue(void * arg) {
+    const struct threaded_arg * threaded = arg;
+
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        mque_enqueue(threaded->queue, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = 0;
+        while (!mque_dequeue(threaded->queue, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    mqueue_s test = mque_create(SHARD_COUNT, sizeof(DATA_TYPE));
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .queue = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, enqueue_dequeue, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", mque_is_empty(&test));
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be dequeued exactly once.", 1, taken[i]);
+    }
+
+    mque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_mqueue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01); RUN_TEST(ENQUEUE_02);
+    // dequeue
+    RUN_TEST(DEQUEUE_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/shmqueue.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define THREADED_COUNT (1 << 16)
+#define SEGMENT_NAME "/normads_shmqueue_unit"
+
+TEST CREATE_01(void) {
+    shmqueue_s test = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    ASSERT_NEQm("[IRS-ERROR] Test queue header is NULL.", NULL, test.header);
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not REALLOC_CHUNK.", REALLOC_CHUNK, test.capacity);
+    ASSERTm("[IRS-ERROR] Expected queue to be valid.", shmq_is_valid(&test));
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", shmq_is_empty(&test));
+
+    shmq_detach(&test);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST CREATE_02(void) {
+    shmqueue_s test = shmq_create(SEGMENT_NAME, REALLOC_CHUNK + 1, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not rounded to power of two.", REALLOC_CHUNK << 1, test.capacity);
+
+    shmq_detach(&test);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST ATTACH_01(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+
+    ASSERT_NEQm("[IRS-ERROR] Attached queue header is NULL.", NULL, consumer.header);
+    ASSERT_EQm("[IRS-ERROR] Attached queue capacity is not REALLOC_CHUNK.", REALLOC_CHUNK, consumer.capacity);
+    ASSERTm("[IRS-ERROR] Expected attached queue to be valid.", shmq_is_valid(&consumer));
+
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST ATTACH_02(void) {
+    shmq_unlink(SEGMENT_NAME);
+    shmqueue_s test = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Expected missing segment to return NULL header.", NULL, test.header);
+
+    PASS();
+}
+
+TEST ATTACH_03(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE) + 1);
+
+    ASSERT_EQm("[IRS-ERROR] Expected element size mismatch to return NULL header.", NULL, consumer.header);
+
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST DETACH_01(void) {
+    shmqueue_s test = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmq_detach(&test);
+
+    ASSERT_EQm("[IRS-ERROR] Test queue header is not NULL.", NULL, test.header);
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not zero.", 0, test.capacity);
+    ASSERT_FALSEm("[IRS-ERROR] Expected detached queue to be invalid.", shmq_is_valid(&test));
+
+    ASSERTm("[IRS-ERROR] Expected segment to be unlinked.", shmq_unlink(SEGMENT_NAME));
+    ASSERT_FALSEm("[IRS-ERROR] Expected second unlink to fail.", shmq_unlink(SEGMENT_NAME));
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    shmqueue_s test = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        shmq_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    ASSERT_FALSEm("[IRS-ERROR] Expected queue to not be full.", shmq_is_full(&test));
+
+    const DATA_TYPE a = 42;
+    shmq_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected queue to be full.", shmq_is_full(&test));
+    ASSERT_FALSEm("[IRS-ERROR] Expected enqueue into full queue to fail.", shmq_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    shmq_detach(&test);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERTm("[IRS-ERROR] Expected enqueue to succeed.", shmq_enqueue(&producer, &i, sizeof(DATA_TYPE)));
+    }
+    ASSERT_FALSEm("[IRS-ERROR] Expected attached queue to not be empty.", shmq_is_empty(&consumer));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected dequeue to succeed.", shmq_dequeue(&consumer, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, b);
+    }
+    ASSERTm("[IRS-ERROR] Expected producer's queue to be empty.", shmq_is_empty(&producer));
+
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    shmqueue_s test = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected dequeue from empty queue to fail.", shmq_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    shmq_detach(&test);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST ENQUEUE_N_01(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+
+    DATA_TYPE elements[REALLOC_CHUNK] = { 0 };
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        elements[i] = i;
+    }
+
+    // move indices past ring's middle so that batches wrap around its end
+    ASSERT_EQm("[IRS-ERROR] Expected to enqueue half.", REALLOC_CHUNK / 2, shmq_enqueue_n(&producer, elements, REALLOC_CHUNK / 2, sizeof(DATA_TYPE)));
+    DATA_TYPE buffer[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue half.", REALLOC_CHUNK / 2, shmq_dequeue_n(&consumer, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+
+    ASSERT_EQm("[IRS-ERROR] Expected to enqueue whole capacity.", REALLOC_CHUNK, shmq_enqueue_n(&producer, elements, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected full queue to accept nothing.", 0, shmq_enqueue_n(&producer, elements, 1, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue whole capacity.", REALLOC_CHUNK, shmq_dequeue_n(&consumer, buffer, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, buffer[i]);
+    }
+
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST REINITIALIZE_01(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK / 2; ++i) {
+        shmq_enqueue(&producer, &i, sizeof(DATA_TYPE));
+    }
+
+    // simulates a crashed producer restarting and recreating segment under the same name
+    shmqueue_s restarted = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected restarted queue to be valid.", shmq_is_valid(&restarted));
+    ASSERTm("[IRS-ERROR] Expected restarted queue to be empty.", shmq_is_empty(&restarted));
+    ASSERT_FALSEm("[IRS-ERROR] Expected stale producer to be invalid.", shmq_is_valid(&producer));
+    ASSERT_FALSEm("[IRS-ERROR] Expected stale consumer to be invalid.", shmq_is_valid(&consumer));
+
+    shmq_detach(&restarted);
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST REINITIALIZE_02(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK / 2; ++i) {
+        shmq_enqueue(&producer, &i, sizeof(DATA_TYPE));
+    }
+    DATA_TYPE element = 0;
+    shmq_dequeue(&consumer, &element, sizeof(DATA_TYPE)); // caches producer's tail in stale consumer
+
+    shmqueue_s restarted = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE elements[REALLOC_CHUNK] = { 0 };
+    ASSERT_FALSEm("[IRS-ERROR] Expected stale consumer's dequeue to fail.", shmq_dequeue(&consumer, &element, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected stale consumer's dequeue n to fail.", (size_t)0, shmq_dequeue_n(&consumer, elements, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected restarted queue to stay empty.", shmq_is_empty(&restarted));
+
+    ASSERT_FALSEm("[IRS-ERROR] Expected stale producer's enqueue to fail.", shmq_enqueue(&producer, &element, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected stale producer's enqueue n to fail.", (size_t)0, shmq_enqueue_n(&producer, elements, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected restarted queue to stay empty.", shmq_is_empty(&restarted));
+
+    shmq_detach(&restarted);
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+TEST REINITIALIZE_03(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    shmqueue_s resized = shmq_create(SEGMENT_NAME, REALLOC_CHUNK << 1, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected existing segment to not be resized.", NULL, resized.header);
+    ASSERTm("[IRS-ERROR] Expected existing queue to stay valid.", shmq_is_valid(&producer));
+
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+static void * produce(void * queue) {
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        while (!shmq_enqueue(queue, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    shmqueue_s producer = shmq_create(SEGMENT_NAME, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shmqueue_s consumer = shmq_attach(SEGMENT_NAME, sizeof(DATA_TYPE));
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, produce, &producer);
+
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        DATA_TYPE b = 0;
+        while (!shmq_dequeue(&consumer, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, b);
+    }
+
+    pthread_join(thread, NULL);
+    shmq_detach(&consumer);
+    shmq_detach(&producer);
+    shmq_unlink(SEGMENT_NAME);
+    PASS();
+}
+
+SUITE (scale_shmqueue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_02);
+    // attach
+    RUN_TEST(ATTACH_01); RUN_TEST(ATTACH_02); RUN_TEST(ATTACH_03);
+    // detach
+    RUN_TEST(DETACH_01);
+    // is full
+    RUN_TEST(IS_FULL_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // dequeue
+    RUN_TEST(DEQUEUE_01);
+    // enqueue n
+    RUN_TEST(ENQUEUE_N_01);
+    // reinitialize
+    RUN_TEST(REINITIALIZE_01); RUN_TEST(REINITIALIZE_02); RUN_TEST(REINITIALIZE_03);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
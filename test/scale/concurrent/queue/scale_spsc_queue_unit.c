@@ -0,0 +1,230 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/queue/spscqueue.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define THREADED_COUNT (1 << 16)
+
+TEST CREATE_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not REALLOC_CHUNK.", REALLOC_CHUNK, test.capacity);
+    ASSERT_NEQm("[IRS-ERROR] Test queue elements is NULL.", NULL, test.elements);
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", spsc_is_empty(&test));
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CREATE_02(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK + 1, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not rounded to power of two.", REALLOC_CHUNK << 1, test.capacity);
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        spsc_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test queue capacity is not zero.", 0, test.capacity);
+    ASSERT_EQm("[IRS-ERROR] Test queue elements is not NULL.", NULL, test.elements);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        spsc_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    ASSERT_FALSEm("[IRS-ERROR] Expected queue to not be full.", spsc_is_full(&test));
+
+    const DATA_TYPE a = 42;
+    spsc_enqueue(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected queue to be full.", spsc_is_full(&test));
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    ASSERTm("[IRS-ERROR] Expected element to be enqueued.", spsc_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    DATA_TYPE b = 0;
+    ASSERTm("[IRS-ERROR] Expected element to be dequeued.", spsc_dequeue(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_02(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be enqueued.", spsc_enqueue(&test, &i, sizeof(DATA_TYPE)));
+    }
+
+    const DATA_TYPE a = 42;
+    ASSERT_FALSEm("[IRS-ERROR] Expected full queue to reject element.", spsc_enqueue(&test, &a, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        spsc_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_03(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    // cycle through ring more than once so indexes wrap around
+    for (int i = 0; i < REALLOC_CHUNK * 3; ++i) {
+        spsc_enqueue(&test, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = 0;
+        spsc_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty queue to not dequeue.", spsc_dequeue(&test, &b, sizeof(DATA_TYPE)));
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_N_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE elements[REALLOC_CHUNK + 1] = { 0 };
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        elements[i] = i;
+    }
+
+    const size_t count = spsc_enqueue_n(&test, elements, REALLOC_CHUNK + 1, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected only capacity elements to be enqueued.", REALLOC_CHUNK, count);
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        spsc_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_N_02(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    // move start of queue to the middle of ring, so that batch wraps around its end
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        DATA_TYPE b = 0;
+        spsc_enqueue(&test, &i, sizeof(DATA_TYPE));
+        spsc_dequeue(&test, &b, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE elements[REALLOC_CHUNK] = { 0 };
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        elements[i] = i;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected all elements to be enqueued.", REALLOC_CHUNK, spsc_enqueue_n(&test, elements, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+
+    DATA_TYPE result[REALLOC_CHUNK] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected all elements to be dequeued.", REALLOC_CHUNK, spsc_dequeue_n(&test, result, REALLOC_CHUNK, sizeof(DATA_TYPE)));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, result[i]);
+    }
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_N_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        spsc_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE result[REALLOC_CHUNK] = { 0 };
+    const size_t count = spsc_dequeue_n(&test, result, REALLOC_CHUNK, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected only enqueued elements to be dequeued.", REALLOC_CHUNK >> 1, count);
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, result[i]);
+    }
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", spsc_is_empty(&test));
+
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static void * produce(void * queue) {
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        while (!spsc_enqueue(queue, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    spscqueue_s test = spsc_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, produce, &test);
+
+    for (int i = 0; i < THREADED_COUNT; ++i) {
+        DATA_TYPE b = 0;
+        while (!spsc_dequeue(&test, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, b);
+    }
+
+    pthread_join(producer, NULL);
+    spsc_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_spsc_queue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_02);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // is full
+    RUN_TEST(IS_FULL_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01); RUN_TEST(ENQUEUE_02); RUN_TEST(ENQUEUE_03);
+    // dequeue
+    RUN_TEST(DEQUEUE_01);
+    // enqueue n
+    RUN_TEST(ENQUEUE_N_01); RUN_TEST(ENQUEUE_N_02);
+    // dequeue n
+    RUN_TEST(DEQUEUE_N_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
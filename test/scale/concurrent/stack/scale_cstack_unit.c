@@ -0,0 +1,181 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/stack/cstack.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define THREAD_COUNT 2
+#define THREADED_COUNT (1 << 14)
+
+TEST CREATE_01(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", cstk_is_empty(&test));
+    ASSERT_NEQm("[IRS-ERROR] Test stack nodes are NULL.", NULL, test.nodes);
+    ASSERT_NEQm("[IRS-ERROR] Test stack exchanges are NULL.", NULL, test.exchanges);
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        cstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test stack nodes are not NULL.", NULL, test.nodes);
+    ASSERT_EQm("[IRS-ERROR] Test stack exchanges are not NULL.", NULL, test.exchanges);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    ASSERTm("[IRS-ERROR] Expected element to be pushed.", cstk_push(&test, &a, sizeof(DATA_TYPE)));
+    ASSERT_FALSEm("[IRS-ERROR] Expected stack to not be empty.", cstk_is_empty(&test));
+
+    DATA_TYPE b = 0;
+    ASSERTm("[IRS-ERROR] Expected element to be poped.", cstk_pop(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to pop 42.", 42, b);
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        ASSERTm("[IRS-ERROR] Expected element to be pushed.", cstk_push(&test, &i, sizeof(DATA_TYPE)));
+    }
+
+    const DATA_TYPE a = 42;
+    ASSERT_FALSEm("[IRS-ERROR] Expected full stack to not push.", cstk_push(&test, &a, sizeof(DATA_TYPE)));
+
+    for (int i = REALLOC_CHUNK - 1; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        cstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to pop in LIFO order.", i, b);
+    }
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_03(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    // refill stack several times so that every node gets recycled through free list
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < REALLOC_CHUNK; ++i) {
+            const DATA_TYPE a = i + round;
+            ASSERTm("[IRS-ERROR] Expected element to be pushed.", cstk_push(&test, &a, sizeof(DATA_TYPE)));
+        }
+        for (int i = REALLOC_CHUNK - 1; i >= 0; --i) {
+            DATA_TYPE b = 0;
+            cstk_pop(&test, &b, sizeof(DATA_TYPE));
+            ASSERT_EQm("[IRS-ERROR] Expected to pop in LIFO order.", i + round, b);
+        }
+    }
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEP_01(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty stack to not peep.", cstk_peep(&test, &b, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        cstk_push(&test, &i, sizeof(DATA_TYPE));
+        ASSERTm("[IRS-ERROR] Expected element to be peeped.", cstk_peep(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to peep last pushed element.", i, b);
+    }
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_01(void) {
+    cstack_s test = cstk_create(REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty stack to not pop.", cstk_pop(&test, &b, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected stack to stay empty.", cstk_is_empty(&test));
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    cstack_s * stack;
+    int start;
+};
+
+static void * push_pop(void * arg) {
+    const struct threaded_arg * threaded = arg;
+
+    // each thread pushes its own range and pops as much, so pushes and pops race on top and exchanges
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        while (!cstk_push(threaded->stack, &i, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+
+        DATA_TYPE b = 0;
+        while (!cstk_pop(threaded->stack, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    cstack_s test = cstk_create(THREAD_COUNT, sizeof(DATA_TYPE));
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .stack = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, push_pop, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", cstk_is_empty(&test));
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be poped exactly once.", 1, taken[i]);
+    }
+
+    cstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_cstack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02); RUN_TEST(PUSH_03);
+    // peep
+    RUN_TEST(PEEP_01);
+    // pop
+    RUN_TEST(POP_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/concurrent/stack/fcstack.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define THREAD_COUNT 4
+#define THREADED_COUNT (1 << 12)
+
+TEST CREATE_01(void) {
+    fcstack_s test = fcstk_create();
+
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sstk_is_empty(test.stack));
+    ASSERT_NEQm("[IRS-ERROR] Test stack requests are NULL.", NULL, test.requests);
+
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    fcstack_s test = fcstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test stack requests are not NULL.", NULL, test.requests);
+    ASSERT_EQm("[IRS-ERROR] Test stack elements are not NULL.", NULL, test.stack.elements);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    fcstack_s test = fcstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        fcstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        ASSERTm("[IRS-ERROR] Expected element to be poped.", fcstk_pop(&test, &b, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected to pop in LIFO order.", i, b);
+    }
+
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEP_01(void) {
+    fcstack_s test = fcstk_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty stack to not peep.", fcstk_peep(&test, &b, sizeof(DATA_TYPE)));
+
+    const DATA_TYPE a = 42;
+    fcstk_push(&test, &a, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected element to be peeped.", fcstk_peep(&test, &b, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected to peep 42.", 42, b);
+    ASSERT_FALSEm("[IRS-ERROR] Expected stack to not be empty.", sstk_is_empty(test.stack));
+
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_01(void) {
+    fcstack_s test = fcstk_create();
+
+    DATA_TYPE b = 0;
+    ASSERT_FALSEm("[IRS-ERROR] Expected empty stack to not pop.", fcstk_pop(&test, &b, sizeof(DATA_TYPE)));
+
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+static int taken[THREADED_COUNT * THREAD_COUNT];
+
+struct threaded_arg {
+    fcstack_s * stack;
+    int start;
+};
+
+static void * push_pop(void * arg) {
+    const struct threaded_arg * threaded = arg;
+
+    for (int i = threaded->start; i < threaded->start + THREADED_COUNT; ++i) {
+        fcstk_push(threaded->stack, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = 0;
+        while (!fcstk_pop(threaded->stack, &b, sizeof(DATA_TYPE))) {
+            sched_yield();
+        }
+        __atomic_fetch_add(&taken[b], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+TEST THREADED_01(void) {
+    fcstack_s test = fcstk_create();
+
+    pthread_t threads[THREAD_COUNT];
+    struct threaded_arg args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        args[i] = (struct threaded_arg) { .stack = &test, .start = (int)i * THREADED_COUNT, };
+        pthread_create(&threads[i], NULL, push_pop, &args[i]);
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sstk_is_empty(test.stack));
+    for (size_t i = 0; i < THREADED_COUNT * THREAD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected each element to be poped exactly once.", 1, taken[i]);
+    }
+
+    fcstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_fcstack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01);
+    // peep
+    RUN_TEST(PEEP_01);
+    // pop
+    RUN_TEST(POP_01);
+    // threaded
+    RUN_TEST(THREADED_01);
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef UNIT_H
+#define UNIT_H
+
+#include <greatest.h>
+
+SUITE_EXTERN(scale_spsc_queue_unit_test);
+SUITE_EXTERN(scale_mpmc_queue_unit_test);
+SUITE_EXTERN(scale_fcqueue_unit_test);
+SUITE_EXTERN(scale_bqueue_unit_test);
+SUITE_EXTERN(scale_mqueue_unit_test);
+SUITE_EXTERN(scale_shmqueue_unit_test);
+SUITE_EXTERN(scale_evqueue_unit_test);
+SUITE_EXTERN(scale_cdeque_unit_test);
+SUITE_EXTERN(scale_fcdeque_unit_test);
+SUITE_EXTERN(scale_cstack_unit_test);
+SUITE_EXTERN(scale_fcstack_unit_test);
+SUITE_EXTERN(scale_mpool_unit_test);
+SUITE_EXTERN(scale_tpool_unit_test);
+
+#endif // UNIT_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void destroy(void * element) {
     DATA_TYPE * convert = element;
@@ -44,3 +45,24 @@ void manage(void * elements, const size_t n, const size_t size, void * args) {
     function_ptr * arg = args;
     qsort(elements, n, size, arg->compare);
 }
+
+void merge(void * elements, const size_t left_n, const size_t right_n, const size_t size, void * args) {
+    function_ptr * arg = args;
+    char * temporary = malloc((left_n + right_n) * size);
+
+    char * left = elements, * right = (char*)elements + (left_n * size);
+    char * const left_end = right, * const right_end = right + (right_n * size);
+    char * destination = temporary;
+    while (left < left_end && right < right_end) {
+        char ** smaller = arg->compare(right, left) < 0 ? &right : &left;
+        memcpy(destination, (*smaller), size);
+        (*smaller) += size;
+        destination += size;
+    }
+    memcpy(destination, left, (size_t)(left_end - left));
+    destination += left_end - left;
+    memcpy(destination, right, (size_t)(right_end - right));
+
+    memcpy(elements, temporary, (left_n + right_n) * size);
+    free(temporary);
+}
\ No newline at end of file
@@ -22,4 +22,6 @@ int compare_reverse(const void * a, const void * b);
 
 void manage(void * elements, const size_t n, const size_t size, void * args);
 
+void merge(void * elements, const size_t left_n, const size_t right_n, const size_t size, void * args);
+
 #endif // HELPER_H
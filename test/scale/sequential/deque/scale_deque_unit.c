@@ -0,0 +1,593 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/deque/sdeque.h>
+
+TEST CREATE_01(void) {
+    sdeque_s test = sdeq_create();
+
+    ASSERT_EQm("[IRS-ERROR] Test deque size is not zero.", 0, test.size);
+    ASSERT_EQm("[IRS-ERROR] Test deque head is not NULL.", NULL, test.elements);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_01(void) {
+    sdeque_s test = sdeq_create();
+
+    const DATA_TYPE a = 42;
+    sdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42", 42, b);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_02(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_03(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_FRONT_04(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_REAR_01(void) {
+    sdeque_s test = sdeq_create();
+
+    const DATA_TYPE a = 42;
+    sdeq_enqueue_rear(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42", 42, b);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_REAR_02(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_REAR_03(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST ENQUEUE_REAR_04(void) {
+    sdeque_s test = sdeq_create();
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_01(void) {
+    sdeque_s test = sdeq_create();
+    const DATA_TYPE a = 42;
+    sdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE * b = sdeq_at(&test, 0, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected element at index 0 to be 42.", 42, (*b));
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_02(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE * b = sdeq_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_03(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE * b = sdeq_at(&test, (size_t)(REALLOC_CHUNK - 1 - i), sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index 'size - 1 - i' to be i.", i, (*b));
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_04(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE * b = sdeq_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_05(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of its array
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = (REALLOC_CHUNK >> 1) - 1; i >= 0; --i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE * b = sdeq_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_01(void) {
+    sdeque_s test = sdeq_create();
+    const DATA_TYPE a = 0;
+    sdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+
+    const DATA_TYPE c = 42;
+    sdeq_set(&test, 0, &c, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_02(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        const DATA_TYPE a = 0;
+        sdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sdeq_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_03(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        const DATA_TYPE a = 0;
+        sdeq_enqueue_rear(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sdeq_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_04(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        const DATA_TYPE a = 0;
+        sdeq_enqueue_front(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_01(void) {
+    sdeque_s test = sdeq_create();
+
+    sdeque_cursor_s cursor = sdeq_begin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected cursor of empty deque to end.", sdeq_end(cursor));
+
+    cursor = sdeq_rbegin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected reverse cursor of empty deque to end.", sdeq_end(cursor));
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_02(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = 0;
+    for (sdeque_cursor_s cursor = sdeq_begin(&test, sizeof(DATA_TYPE)); !sdeq_end(cursor); sdeq_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i++;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate over each element.", REALLOC_CHUNK + 1, i);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_03(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = REALLOC_CHUNK;
+    for (sdeque_cursor_s cursor = sdeq_rbegin(&test, sizeof(DATA_TYPE)); !sdeq_end(cursor); sdeq_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected reverse cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i--;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected reverse cursor to iterate over each element.", -1, i);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_04(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of its array
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = (REALLOC_CHUNK >> 1) - 1; i >= 0; --i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = 0;
+    for (sdeque_cursor_s cursor = sdeq_begin(&test, sizeof(DATA_TYPE)); !sdeq_end(cursor); sdeq_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i++;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate over each element.", REALLOC_CHUNK, i);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_05(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of its array
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = (REALLOC_CHUNK >> 1) - 1; i >= 0; --i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = REALLOC_CHUNK - 1;
+    for (sdeque_cursor_s cursor = sdeq_rbegin(&test, sizeof(DATA_TYPE)); !sdeq_end(cursor); sdeq_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected reverse cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i--;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected reverse cursor to iterate over each element.", -1, i);
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_01(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = REALLOC_CHUNK - 1; i >= 0; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map(&test, manage, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_02(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map(&test, manage, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_03(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of its array
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map(&test, manage, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_04(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of a partially filled array
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = REALLOC_CHUNK + 1; i < REALLOC_CHUNK + (REALLOC_CHUNK >> 1); ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map(&test, manage, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + (REALLOC_CHUNK >> 1); ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_front(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_01(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map_parallel(&test, manage, merge, 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_02(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map_parallel(&test, manage, merge, 3, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_03(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = REALLOC_CHUNK - 2; i >= 0; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map_parallel(&test, manage, merge, REALLOC_CHUNK << 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_05(void) {
+    sdeque_s test = sdeq_create();
+
+    // wrap deque's elements around the end of its array
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        sdeq_enqueue_rear(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sdeq_map_parallel(&test, manage, merge, 4, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_04(void) {
+    sdeque_s test = sdeq_create();
+    for (int i = (REALLOC_CHUNK >> 1) - 1; i >= 0; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = REALLOC_CHUNK - 1; i >= REALLOC_CHUNK >> 1; --i) {
+        sdeq_enqueue_front(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    // without merge each half is only sorted on its own
+    sdeq_map_parallel(&test, manage, NULL, 2, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sdeq_dequeue_rear(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed deque to dequeue i.", i, b);
+    }
+
+    sdeq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_deque_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // enqueue front
+    RUN_TEST(ENQUEUE_FRONT_01); RUN_TEST(ENQUEUE_FRONT_02); RUN_TEST(ENQUEUE_FRONT_03); RUN_TEST(ENQUEUE_FRONT_04);
+    // enqueue rear
+    RUN_TEST(ENQUEUE_REAR_01); RUN_TEST(ENQUEUE_REAR_02); RUN_TEST(ENQUEUE_REAR_03); RUN_TEST(ENQUEUE_REAR_04);
+    // at
+    RUN_TEST(AT_01); RUN_TEST(AT_02); RUN_TEST(AT_03); RUN_TEST(AT_04); RUN_TEST(AT_05);
+    // set
+    RUN_TEST(SET_01); RUN_TEST(SET_02); RUN_TEST(SET_03); RUN_TEST(SET_04);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(CURSOR_02); RUN_TEST(CURSOR_03); RUN_TEST(CURSOR_04); RUN_TEST(CURSOR_05);
+    // map
+    RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03); RUN_TEST(MAP_04);
+    // map parallel
+    RUN_TEST(MAP_PARALLEL_01); RUN_TEST(MAP_PARALLEL_02); RUN_TEST(MAP_PARALLEL_03); RUN_TEST(MAP_PARALLEL_04);
+    RUN_TEST(MAP_PARALLEL_05);
+}
@@ -0,0 +1,173 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/deque/smdeque.h>
+
+#define SAMPLE_COUNT (REALLOC_CHUNK * 10)
+#define WINDOW 7
+
+/// Produces a repeatable sequence of samples with rises, falls and duplicates.
+static DATA_TYPE sample(const int i) {
+    return (DATA_TYPE)((i * 37) % 23);
+}
+
+/// Finds smallest or largest sample in window ending at 'last' by scanning it.
+static DATA_TYPE scan(const int last, const int window, const bool is_max) {
+    DATA_TYPE extremum = sample(last);
+    for (int i = last - 1; i >= 0 && i > last - window; --i) {
+        const DATA_TYPE current = sample(i);
+        if (is_max ? current > extremum : current < extremum) {
+            extremum = current;
+        }
+    }
+    return extremum;
+}
+
+TEST CREATE_01(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected window to be empty.", smdq_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Test window is not WINDOW.", WINDOW, test.window);
+    ASSERT_EQm("[IRS-ERROR] Test pushed count is not zero.", 0, test.pushed);
+    ASSERT_NEQm("[IRS-ERROR] Test scratch is NULL.", NULL, test.scratch);
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        const DATA_TYPE a = sample(i);
+        smdq_push(&test, &a, sizeof(DATA_TYPE));
+    }
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test elements are not NULL.", NULL, test.elements.elements);
+    ASSERT_EQm("[IRS-ERROR] Test positions are not NULL.", NULL, test.positions.elements);
+    ASSERT_EQm("[IRS-ERROR] Test scratch is not NULL.", NULL, test.scratch);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    smdq_push(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    smdq_peek(test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek single pushed element.", a, b);
+    ASSERT_FALSEm("[IRS-ERROR] Expected window to not be empty.", smdq_is_empty(test));
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        const DATA_TYPE a = sample(i);
+        smdq_push(&test, &a, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = -1;
+        smdq_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to peek smallest element in window.", scan(i, WINDOW, false), b);
+        ASSERTm("[IRS-ERROR] Expected candidates to not exceed window.", test.elements.size <= WINDOW);
+    }
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_03(void) {
+    smdeque_s test = smdq_create(WINDOW, compare_reverse, sizeof(DATA_TYPE));
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        const DATA_TYPE a = sample(i);
+        smdq_push(&test, &a, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = -1;
+        smdq_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected reverse comparator to peek largest element in window.", scan(i, WINDOW, true), b);
+    }
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_04(void) {
+    smdeque_s test = smdq_create(1, compare, sizeof(DATA_TYPE));
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        const DATA_TYPE a = sample(i);
+        smdq_push(&test, &a, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = -1;
+        smdq_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected window of one to peek last pushed element.", a, b);
+    }
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_05(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        smdq_push(&test, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = -1;
+        smdq_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected increasing samples to evict oldest by position.", i < WINDOW ? 0 : i - WINDOW + 1, b);
+    }
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_01(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+
+    DATA_TYPE samples[SAMPLE_COUNT] = { 0 };
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        samples[i] = sample(i);
+    }
+
+    // ingest whole windows at once, plus uneven remainders
+    for (int i = 0; i < SAMPLE_COUNT;) {
+        const int n = (i % 3) ? WINDOW : (WINDOW * 2) + 1;
+        const int count = i + n > SAMPLE_COUNT ? SAMPLE_COUNT - i : n;
+        smdq_push_n(&test, samples + i, (size_t)count, sizeof(DATA_TYPE));
+        i += count;
+
+        DATA_TYPE b = -1;
+        smdq_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to peek smallest element in window after batch.", scan(i - 1, WINDOW, false), b);
+        ASSERT_EQm("[IRS-ERROR] Expected pushed count to include skipped elements.", (size_t)i, test.pushed);
+    }
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_02(void) {
+    smdeque_s test = smdq_create(WINDOW, compare, sizeof(DATA_TYPE));
+    smdq_push_n(&test, NULL, 0, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected window to be empty.", smdq_is_empty(test));
+
+    smdq_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_monotonic_deque_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02); RUN_TEST(PUSH_03); RUN_TEST(PUSH_04); RUN_TEST(PUSH_05);
+    // push n
+    RUN_TEST(PUSH_N_01); RUN_TEST(PUSH_N_02);
+}
\ No newline at end of file
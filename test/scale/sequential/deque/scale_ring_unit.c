@@ -0,0 +1,171 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/deque/sring.h>
+
+#define CAPACITY 10
+
+TEST CREATE_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+
+    ASSERT_NEQm("[IRS-ERROR] Test ring elements is NULL.", NULL, test.deque.elements);
+    ASSERT_EQm("[IRS-ERROR] Test ring capacity is not CAPACITY.", CAPACITY, test.deque.capacity);
+    ASSERTm("[IRS-ERROR] Expected ring to be empty.", srng_is_empty(test));
+    ASSERT_FALSEm("[IRS-ERROR] Expected ring to not be full.", srng_is_full(test));
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+    for (int i = 0; i < CAPACITY * 2 + 3; ++i) {
+        srng_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test ring elements is not NULL.", NULL, test.deque.elements);
+    ASSERT_EQm("[IRS-ERROR] Test ring size is not zero.", 0, test.deque.size);
+    ASSERT_EQm("[IRS-ERROR] Test ring capacity is not zero.", 0, test.deque.capacity);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+    void * elements = test.deque.elements;
+
+    for (int i = 0; i < CAPACITY; ++i) {
+        ASSERT_FALSEm("[IRS-ERROR] Expected push into non-full ring to not overwrite.", srng_push(&test, &i, sizeof(DATA_TYPE)));
+    }
+    ASSERTm("[IRS-ERROR] Expected ring to be full.", srng_is_full(test));
+
+    for (int i = CAPACITY; i < CAPACITY * 3 + 3; ++i) {
+        ASSERTm("[IRS-ERROR] Expected push into full ring to overwrite.", srng_push(&test, &i, sizeof(DATA_TYPE)));
+
+        DATA_TYPE oldest = -1, newest = -1;
+        sdeq_peek_rear(test.deque, &oldest, sizeof(DATA_TYPE));
+        sdeq_peek_front(test.deque, &newest, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected oldest element at rear.", i - CAPACITY + 1, oldest);
+        ASSERT_EQm("[IRS-ERROR] Expected newest element at front.", i, newest);
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected ring to never reallocate.", elements, test.deque.elements);
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+    for (int i = 0; i < CAPACITY + 4; ++i) {
+        srng_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    // deque's cursor and index access read ring from oldest to newest
+    int expected = 4;
+    for (sdeque_cursor_s cursor = sdeq_begin(&test.deque, sizeof(DATA_TYPE)); !sdeq_end(cursor); sdeq_next(&cursor), ++expected) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate from oldest to newest.", expected, *(DATA_TYPE*)cursor.element);
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected index zero to be oldest.", 4, *(DATA_TYPE*)sdeq_at(&test.deque, 0, sizeof(DATA_TYPE)));
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+
+    DATA_TYPE elements[CAPACITY * 3] = { 0 };
+    for (int i = 0; i < CAPACITY * 3; ++i) {
+        elements[i] = i;
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected nothing overwritten.", 0, srng_push_n(&test, elements, CAPACITY - 3, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected two overwritten.", 2, srng_push_n(&test, elements + CAPACITY - 3, 5, sizeof(DATA_TYPE)));
+
+    DATA_TYPE snapshot[CAPACITY] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected full snapshot.", CAPACITY, srng_snapshot(test, snapshot, sizeof(DATA_TYPE)));
+    for (int i = 0; i < CAPACITY; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected snapshot in order after wrapping batch.", i + 2, snapshot[i]);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected larger batch to skip and overwrite.", CAPACITY * 2 + 5, srng_push_n(&test, elements + 5, CAPACITY * 2 + 5, sizeof(DATA_TYPE)));
+    srng_snapshot(test, snapshot, sizeof(DATA_TYPE));
+    for (int i = 0; i < CAPACITY; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected snapshot to hold batch's last elements.", (CAPACITY * 2) + i, snapshot[i]);
+    }
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_RECENT_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+
+    DATA_TYPE recent[CAPACITY] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected empty ring to peek nothing.", 0, srng_peek_recent(test, recent, 3, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < 2; ++i) {
+        srng_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected to peek only existing elements.", 2, srng_peek_recent(test, recent, 3, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected older recent element first.", 0, recent[0]);
+    ASSERT_EQm("[IRS-ERROR] Expected newer recent element last.", 1, recent[1]);
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_RECENT_02(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+    for (int i = 0; i < CAPACITY * 2 + 7; ++i) {
+        srng_push(&test, &i, sizeof(DATA_TYPE));
+
+        for (int k = 1; k <= CAPACITY; ++k) {
+            DATA_TYPE recent[CAPACITY] = { 0 };
+            const size_t count = srng_peek_recent(test, recent, (size_t)k, sizeof(DATA_TYPE));
+            const int expected_count = k < i + 1 ? k : i + 1;
+            ASSERT_EQm("[IRS-ERROR] Expected to peek min(k, size) elements.", (size_t)expected_count, count);
+            for (int j = 0; j < expected_count; ++j) {
+                ASSERT_EQm("[IRS-ERROR] Expected recent elements from oldest to newest.", i - expected_count + 1 + j, recent[j]);
+            }
+        }
+    }
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SNAPSHOT_01(void) {
+    sring_s test = srng_create(CAPACITY, sizeof(DATA_TYPE));
+
+    DATA_TYPE snapshot[CAPACITY] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected empty snapshot.", 0, srng_snapshot(test, snapshot, sizeof(DATA_TYPE)));
+
+    for (int i = 0; i < CAPACITY + 6; ++i) {
+        srng_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected full snapshot.", CAPACITY, srng_snapshot(test, snapshot, sizeof(DATA_TYPE)));
+    for (int i = 0; i < CAPACITY; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected wrapped snapshot in order.", i + 6, snapshot[i]);
+    }
+
+    srng_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_ring_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // push n
+    RUN_TEST(PUSH_N_01);
+    // peek recent
+    RUN_TEST(PEEK_RECENT_01); RUN_TEST(PEEK_RECENT_02);
+    // snapshot
+    RUN_TEST(SNAPSHOT_01);
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/heap/sheap.h>
+
+#include <string.h>
+
+#define LARGE_COUNT (REALLOC_CHUNK * 100)
+
+/// Produces a scrambled but repeatable permutation of [0, count) values.
+static DATA_TYPE scrambled(const int i, const int count) {
+    return (DATA_TYPE)((i * 7919) % count);
+}
+
+TEST CREATE_01(void) {
+    sheap_s test = shep_create(2, compare);
+
+    ASSERT_EQm("[IRS-ERROR] Test heap size is not zero.", 0, test.stack.size);
+    ASSERT_EQm("[IRS-ERROR] Test heap elements is not NULL.", NULL, test.stack.elements);
+    ASSERT_EQm("[IRS-ERROR] Test heap arity is not 2.", 2, test.arity);
+    ASSERTm("[IRS-ERROR] Expected heap to be empty.", shep_is_empty(test));
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sheap_s test = shep_create(4, compare);
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        shep_push(&test, &i, sizeof(DATA_TYPE));
+    }
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test heap size is not zero.", 0, test.stack.size);
+    ASSERT_EQm("[IRS-ERROR] Test heap elements is not NULL.", NULL, test.stack.elements);
+    ASSERT_EQm("[IRS-ERROR] Test heap compare is not NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    sheap_s test = shep_create(2, compare);
+    ASSERT_FALSEm("[IRS-ERROR] Expected heap to not be full.", shep_is_full(test));
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    sheap_s test = shep_create(2, compare);
+
+    const DATA_TYPE a = 42;
+    shep_push(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    shep_peek(test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek pushed element.", a, b);
+    ASSERT_FALSEm("[IRS-ERROR] Expected heap to not be empty.", shep_is_empty(test));
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    sheap_s test = shep_create(2, compare);
+    for (int i = REALLOC_CHUNK - 1; i >= 0; --i) {
+        shep_push(&test, &i, sizeof(DATA_TYPE));
+
+        DATA_TYPE b = -1;
+        shep_peek(test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected smallest element on top.", i, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_01(void) {
+    sheap_s test = shep_create(2, compare);
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        const DATA_TYPE a = scrambled(i, LARGE_COUNT);
+        shep_push(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to pop elements in ascending order.", i, b);
+    }
+    ASSERTm("[IRS-ERROR] Expected heap to be empty.", shep_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Test heap elements is not NULL.", NULL, test.stack.elements);
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_02(void) {
+    sheap_s test = shep_create(4, compare);
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        const DATA_TYPE a = scrambled(i, LARGE_COUNT);
+        shep_push(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to pop elements in ascending order.", i, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_03(void) {
+    sheap_s test = shep_create(8, compare_reverse);
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        const DATA_TYPE a = scrambled(i, LARGE_COUNT);
+        shep_push(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = LARGE_COUNT - 1; i >= 0; --i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected reverse comparator to pop elements in descending order.", i, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_04(void) {
+    sheap_s test = shep_create(4, compare);
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        const DATA_TYPE a = i % 3; // duplicates must all come out
+        shep_push(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    DATA_TYPE previous = -1;
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERTm("[IRS-ERROR] Expected popped elements to not decrease.", previous <= b);
+        previous = b;
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_01(void) {
+    sheap_s test = shep_create(4, compare);
+
+    DATA_TYPE elements[LARGE_COUNT] = { 0 };
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        elements[i] = scrambled(i, LARGE_COUNT);
+    }
+    shep_push_n(&test, elements, LARGE_COUNT, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected heap size to be LARGE_COUNT.", LARGE_COUNT, test.stack.size);
+
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected built heap to pop elements in ascending order.", i, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_02(void) {
+    sheap_s test = shep_create(2, compare);
+
+    DATA_TYPE elements[LARGE_COUNT] = { 0 };
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        elements[i] = scrambled(i, LARGE_COUNT);
+    }
+    // a large batch builds heap, while a small batch into a larger heap sifts each element up
+    shep_push_n(&test, elements, LARGE_COUNT - REALLOC_CHUNK, sizeof(DATA_TYPE));
+    shep_push_n(&test, elements + LARGE_COUNT - REALLOC_CHUNK, REALLOC_CHUNK, sizeof(DATA_TYPE));
+
+    for (int i = 0; i < LARGE_COUNT; ++i) {
+        DATA_TYPE b = -1;
+        shep_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected heap to pop elements in ascending order.", i, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_03(void) {
+    sheap_s test = shep_create(8, compare);
+    shep_push_n(&test, NULL, 0, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected heap to be empty.", shep_is_empty(test));
+
+    const DATA_TYPE a = 42;
+    shep_push_n(&test, &a, 1, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    shep_peek(test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek single pushed element.", a, b);
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST COPY_01(void) {
+    sheap_s test = shep_create(4, compare);
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        const DATA_TYPE a = scrambled(i, REALLOC_CHUNK);
+        shep_push(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    sheap_s copy = shep_copy(test, memcpy, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected sizes to be equal.", test.stack.size, copy.stack.size);
+    ASSERT_EQm("[IRS-ERROR] Expected arities to be equal.", test.arity, copy.arity);
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE a = -1, b = -1;
+        shep_pop(&test, &a, sizeof(DATA_TYPE));
+        shep_pop(&copy, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected copy to pop same elements.", a, b);
+    }
+
+    shep_destroy(&test, destroy, sizeof(DATA_TYPE));
+    shep_destroy(&copy, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_heap_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // is full
+    RUN_TEST(IS_FULL_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02); RUN_TEST(POP_03); RUN_TEST(POP_04);
+    // push n
+    RUN_TEST(PUSH_N_01); RUN_TEST(PUSH_N_02); RUN_TEST(PUSH_N_03);
+    // copy
+    RUN_TEST(COPY_01);
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/heap/sradix.h>
+
+#include <stdlib.h>
+
+#define KEY_COUNT 1000
+
+TEST CREATE_01(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+
+    ASSERT_NEQm("[IRS-ERROR] Test heap buckets is NULL.", NULL, test.buckets);
+    ASSERT_EQm("[IRS-ERROR] Test heap last key is not zero.", (uint64_t)0, test.last);
+    ASSERTm("[IRS-ERROR] Expected heap to be empty.", srdx_is_empty(test));
+
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        srdx_push(&test, (uint64_t)(i * 31 % 97), &i, sizeof(DATA_TYPE));
+    }
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test heap buckets is not NULL.", NULL, test.buckets);
+    ASSERT_EQm("[IRS-ERROR] Test heap size is not zero.", (size_t)0, test.size);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+
+    srand(42);
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        const DATA_TYPE element = rand() % KEY_COUNT;
+        srdx_push(&test, (uint64_t)element, &element, sizeof(DATA_TYPE));
+    }
+
+    uint64_t previous = 0;
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        DATA_TYPE element = -1;
+        const uint64_t key = srdx_pop(&test, &element, sizeof(DATA_TYPE));
+        ASSERTm("[IRS-ERROR] Expected keys to be popped in order.", previous <= key);
+        ASSERT_EQm("[IRS-ERROR] Expected element pushed with popped key.", key, (uint64_t)element);
+        previous = key;
+    }
+    ASSERTm("[IRS-ERROR] Expected heap to be empty.", srdx_is_empty(test));
+
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+
+    // shortest-path-like workload, where every popped key pushes larger keys
+    srand(42);
+    DATA_TYPE element = 0;
+    srdx_push(&test, 0, &element, sizeof(DATA_TYPE));
+
+    uint64_t previous = 0;
+    for (int popped = 0; popped < KEY_COUNT * 10; ++popped) {
+        const uint64_t key = srdx_pop(&test, &element, sizeof(DATA_TYPE));
+        ASSERTm("[IRS-ERROR] Expected keys to be popped in order.", previous <= key);
+        ASSERT_EQm("[IRS-ERROR] Expected element pushed with popped key.", key, (uint64_t)element);
+        previous = key;
+
+        for (int i = 0; i < 2; ++i) {
+            const DATA_TYPE next = element + (rand() % 50);
+            srdx_push(&test, (uint64_t)next, &next, sizeof(DATA_TYPE));
+        }
+    }
+
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_03(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+
+    const uint64_t keys[] = { UINT64_MAX, (uint64_t)1 << 63, 0, UINT64_MAX - 1, 1, ((uint64_t)1 << 63) - 1, 0, UINT64_MAX, };
+    const uint64_t sorted[] = { 0, 0, 1, ((uint64_t)1 << 63) - 1, (uint64_t)1 << 63, UINT64_MAX - 1, UINT64_MAX, UINT64_MAX, };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(uint64_t); ++i) {
+        const DATA_TYPE element = (DATA_TYPE)i;
+        srdx_push(&test, keys[i], &element, sizeof(DATA_TYPE));
+    }
+
+    for (size_t i = 0; i < sizeof(sorted) / sizeof(uint64_t); ++i) {
+        DATA_TYPE element = -1;
+        ASSERT_EQm("[IRS-ERROR] Expected extreme keys to be popped in order.", sorted[i], srdx_pop(&test, &element, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected element pushed with popped key.", sorted[i], keys[element]);
+    }
+
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PEEK_01(void) {
+    sradix_s test = srdx_create(sizeof(DATA_TYPE));
+    for (int i = KEY_COUNT; i > 0; --i) {
+        srdx_push(&test, (uint64_t)i * 3, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 1; i <= KEY_COUNT; ++i) {
+        DATA_TYPE peeked = -1, popped = -1;
+        const uint64_t key = srdx_peek(&test, &peeked, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected peek to not change size.", (size_t)(KEY_COUNT - i + 1), test.size);
+        ASSERT_EQm("[IRS-ERROR] Expected peeked key to be popped next.", key, srdx_pop(&test, &popped, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected peeked element to be popped next.", peeked, popped);
+        ASSERT_EQm("[IRS-ERROR] Expected smallest element.", i, popped);
+    }
+
+    srdx_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_radix_heap_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02); RUN_TEST(PUSH_03);
+    // peek
+    RUN_TEST(PEEK_01);
+}
\ No newline at end of file
@@ -6,7 +6,20 @@ int main(const int argc, char **argv) {
     GREATEST_MAIN_BEGIN();
 
     RUN_SUITE(scale_stack_unit_test);
+    RUN_SUITE(scale_extrema_stack_unit_test);
+    RUN_SUITE(scale_column_stack_unit_test);
+    RUN_SUITE(scale_blob_stack_unit_test);
+    RUN_SUITE(scale_packed_stack_unit_test);
     RUN_SUITE(scale_queue_unit_test);
+    RUN_SUITE(scale_aggregate_queue_unit_test);
+    RUN_SUITE(scale_timer_wheel_unit_test);
+    RUN_SUITE(scale_column_queue_unit_test);
+    RUN_SUITE(scale_blob_queue_unit_test);
+    RUN_SUITE(scale_deque_unit_test);
+    RUN_SUITE(scale_monotonic_deque_unit_test);
+    RUN_SUITE(scale_ring_unit_test);
+    RUN_SUITE(scale_heap_unit_test);
+    RUN_SUITE(scale_radix_heap_unit_test);
 
     GREATEST_MAIN_END();
 }
\ No newline at end of file
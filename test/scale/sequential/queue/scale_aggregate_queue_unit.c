@@ -0,0 +1,193 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/queue/saqueue.h>
+
+#define WINDOW 13
+
+static void sum(void * left, const void * right) {
+    DATA_TYPE * convert_left = left;
+    const DATA_TYPE * convert_right = right;
+    (*convert_left) += (*convert_right);
+}
+
+static void maximum(void * left, const void * right) {
+    DATA_TYPE * convert_left = left;
+    const DATA_TYPE * convert_right = right;
+    if ((*convert_right) > (*convert_left)) {
+        (*convert_left) = (*convert_right);
+    }
+}
+
+static void first(void * left, const void * right) { // associative but not commutative, keeps oldest element
+    (void)(left);
+    (void)(right);
+}
+
+/// Produces a repeatable sequence of samples.
+static DATA_TYPE sample(const int i) {
+    return (DATA_TYPE)((i * 37) % 23);
+}
+
+TEST CREATE_01(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", saqu_is_empty(test));
+    ASSERT_NEQm("[IRS-ERROR] Test back aggregate is NULL.", NULL, test.back_aggregate);
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        saqu_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    DATA_TYPE a = 0;
+    saqu_dequeue(&test, &a, sizeof(DATA_TYPE)); // moves elements to front, so both stacks get destroyed
+    saqu_enqueue(&test, &a, sizeof(DATA_TYPE));
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test front is not NULL.", NULL, test.front.elements);
+    ASSERT_EQm("[IRS-ERROR] Test back is not NULL.", NULL, test.back.elements);
+    ASSERT_EQm("[IRS-ERROR] Test back aggregate is not NULL.", NULL, test.back_aggregate);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+
+    const DATA_TYPE a = 42;
+    saqu_enqueue(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0, c = 0;
+    saqu_peek(test, &b, sizeof(DATA_TYPE));
+    saqu_aggregate(test, &c, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to peek enqueued element.", a, b);
+    ASSERT_EQm("[IRS-ERROR] Expected aggregate of single element to be element.", a, c);
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+    for (int i = 0; i < REALLOC_CHUNK * 3; ++i) {
+        saqu_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK * 3; ++i) {
+        DATA_TYPE a = -1, b = -1;
+        saqu_peek(test, &a, sizeof(DATA_TYPE));
+        saqu_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to peek i.", i, a);
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i in order.", i, b);
+    }
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", saqu_is_empty(test));
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DEQUEUE_02(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+
+    // interleave so that elements sit in both stacks while dequeuing
+    int next_enqueue = 0, next_dequeue = 0;
+    for (int round = 0; round < REALLOC_CHUNK; ++round) {
+        for (int i = 0; i < 3; ++i, ++next_enqueue) {
+            saqu_enqueue(&test, &next_enqueue, sizeof(DATA_TYPE));
+        }
+        for (int i = 0; i < 2; ++i, ++next_dequeue) {
+            DATA_TYPE a = -1;
+            saqu_dequeue(&test, &a, sizeof(DATA_TYPE));
+            ASSERT_EQm("[IRS-ERROR] Expected to dequeue elements in order.", next_dequeue, a);
+        }
+    }
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AGGREGATE_01(void) {
+    saqueue_s test = saqu_create(sum, sizeof(DATA_TYPE));
+
+    DATA_TYPE expected = 0;
+    for (int i = 0; i < REALLOC_CHUNK * 10; ++i) {
+        const DATA_TYPE a = sample(i);
+        saqu_enqueue(&test, &a, sizeof(DATA_TYPE));
+        expected += a;
+        if (i >= WINDOW) {
+            DATA_TYPE b = 0;
+            saqu_dequeue(&test, &b, sizeof(DATA_TYPE));
+            expected -= b;
+        }
+
+        DATA_TYPE c = -1;
+        saqu_aggregate(test, &c, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected aggregate to be window's sum.", expected, c);
+    }
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AGGREGATE_02(void) {
+    saqueue_s test = saqu_create(maximum, sizeof(DATA_TYPE));
+
+    for (int i = 0; i < REALLOC_CHUNK * 10; ++i) {
+        const DATA_TYPE a = sample(i);
+        saqu_enqueue(&test, &a, sizeof(DATA_TYPE));
+        if (i >= WINDOW) {
+            DATA_TYPE b = 0;
+            saqu_dequeue(&test, &b, sizeof(DATA_TYPE));
+        }
+
+        DATA_TYPE expected = sample(i);
+        for (int j = i - 1; j >= 0 && j > i - WINDOW; --j) {
+            expected = sample(j) > expected ? sample(j) : expected;
+        }
+        DATA_TYPE c = -1;
+        saqu_aggregate(test, &c, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected aggregate to be window's maximum.", expected, c);
+    }
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AGGREGATE_03(void) {
+    saqueue_s test = saqu_create(first, sizeof(DATA_TYPE));
+
+    for (int i = 0; i < REALLOC_CHUNK * 10; ++i) {
+        saqu_enqueue(&test, &i, sizeof(DATA_TYPE));
+        if (i >= WINDOW) {
+            DATA_TYPE b = 0;
+            saqu_dequeue(&test, &b, sizeof(DATA_TYPE));
+        }
+
+        DATA_TYPE a = -1, c = -1;
+        saqu_peek(test, &a, sizeof(DATA_TYPE));
+        saqu_aggregate(test, &c, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected non-commutative aggregate to combine from oldest to newest.", a, c);
+    }
+
+    saqu_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_aggregate_queue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // dequeue
+    RUN_TEST(DEQUEUE_01); RUN_TEST(DEQUEUE_02);
+    // aggregate
+    RUN_TEST(AGGREGATE_01); RUN_TEST(AGGREGATE_02); RUN_TEST(AGGREGATE_03);
+}
\ No newline at end of file
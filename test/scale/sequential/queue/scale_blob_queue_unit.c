@@ -0,0 +1,192 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/queue/sbqueue.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define BLOB_COUNT (REALLOC_CHUNK * 3 + 5)
+#define MAX_LENGTH 17
+
+static size_t destroyed = 0;
+
+static void count(void * blob) {
+    (void)(blob);
+    destroyed++;
+}
+
+/// @brief Fills buffer with i-th blob, where every MAX_LENGTH-th blob is empty.
+static size_t make(const size_t i, char * buffer) {
+    const size_t length = i % MAX_LENGTH;
+    for (size_t j = 0; j < length; ++j) {
+        buffer[j] = (char)('a' + ((i + j) % 26));
+    }
+    return length;
+}
+
+/// @brief Checks that blobs are iterated in enqueue order, starting at index in arguments.
+static bool check(void * blob, const size_t length, void * args) {
+    size_t * index = args;
+    char expected[MAX_LENGTH] = { 0 };
+    if (length != make(*index, expected) || memcmp(blob, expected, length)) {
+        return false;
+    }
+    (*index)++;
+    return true;
+}
+
+static bool stop_at_ten(void * blob, const size_t length, void * args) {
+    (void)(blob); (void)(length);
+    size_t * index = args;
+    return ++(*index) < 10;
+}
+
+TEST CREATE_01(void) {
+    sbqueue_s test = sbqu_create();
+
+    ASSERT_EQm("[IRS-ERROR] Test queue bytes is not NULL.", NULL, test.bytes);
+    ASSERT_EQm("[IRS-ERROR] Test queue size is not zero.", (size_t)0, test.size);
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", sbqu_is_empty(test));
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbqu_enqueue(&test, buffer, length);
+    }
+
+    size_t length = 0;
+    sbqu_dequeue(&test, &length);
+
+    destroyed = 0;
+    sbqu_destroy(&test, count);
+
+    ASSERT_EQm("[IRS-ERROR] Expected every blob left in queue to be destroyed.", (size_t)BLOB_COUNT - 1, destroyed);
+    ASSERT_EQm("[IRS-ERROR] Test queue bytes is not NULL.", NULL, test.bytes);
+    ASSERT_EQm("[IRS-ERROR] Test queue length is not zero.", (size_t)0, test.length);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbqu_enqueue(&test, buffer, length);
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected queue size to be BLOB_COUNT.", (size_t)BLOB_COUNT, test.size);
+
+    size_t length = 0;
+    char const * blob = sbqu_peek(test, &length);
+    ASSERT_EQm("[IRS-ERROR] Expected first blob to be empty.", (size_t)0, length);
+    ASSERT_EQm("[IRS-ERROR] Expected peeked blob to be aligned.", (size_t)0, (size_t)((uintptr_t)blob % sizeof(size_t)));
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbqu_enqueue(&test, buffer, length);
+    }
+
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+
+        size_t peeked = 0, dequeued = 0;
+        char const * peek = sbqu_peek(test, &peeked);
+        char const * blob = sbqu_dequeue(&test, &dequeued);
+        ASSERT_EQm("[IRS-ERROR] Expected peeked blob to be dequeued.", peek, blob);
+        ASSERT_EQm("[IRS-ERROR] Expected dequeued length to be enqueued length.", length, dequeued);
+        ASSERTm("[IRS-ERROR] Expected dequeued blob to be enqueued blob.", !memcmp(buffer, blob, length));
+    }
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", sbqu_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Expected empty queue to be rewound.", (size_t)0, test.length);
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+TEST DEQUEUE_02(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+
+    // interleave so that records get moved to buffer's front while blobs are still in queue
+    size_t enqueued = 0, dequeued = 0;
+    for (size_t round = 0; round < BLOB_COUNT * 4; ++round) {
+        for (size_t i = 0; i < 3; ++i, ++enqueued) {
+            const size_t length = make(enqueued, buffer);
+            sbqu_enqueue(&test, buffer, length);
+        }
+        for (size_t i = 0; i < 2; ++i, ++dequeued) {
+            const size_t length = make(dequeued, buffer);
+            size_t got = 0;
+            char const * blob = sbqu_dequeue(&test, &got);
+            ASSERT_EQm("[IRS-ERROR] Expected blobs in enqueue order.", length, got);
+            ASSERTm("[IRS-ERROR] Expected dequeued blob to be enqueued blob.", !memcmp(buffer, blob, length));
+        }
+    }
+
+    size_t index = dequeued;
+    sbqu_foreach(&test, check, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected remaining blobs to be unchanged.", enqueued, index);
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+TEST FOREACH_01(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbqu_enqueue(&test, buffer, length);
+    }
+
+    size_t index = 0;
+    sbqu_foreach(&test, check, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected to iterate each blob from start to end.", (size_t)BLOB_COUNT, index);
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+TEST FOREACH_02(void) {
+    sbqueue_s test = sbqu_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbqu_enqueue(&test, buffer, length);
+    }
+
+    size_t index = 0;
+    sbqu_foreach(&test, stop_at_ten, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected iteration to stop when operate returns false.", (size_t)10, index);
+
+    sbqu_destroy(&test, count);
+    PASS();
+}
+
+SUITE (scale_blob_queue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // dequeue
+    RUN_TEST(DEQUEUE_01); RUN_TEST(DEQUEUE_02);
+    // foreach
+    RUN_TEST(FOREACH_01); RUN_TEST(FOREACH_02);
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/queue/scqueue.h>
+
+#include <stddef.h>
+
+#define RECORD_COUNT (REALLOC_CHUNK * 3 + 5)
+
+typedef struct record {
+    DATA_TYPE key;
+    char tag;
+    double value;
+} record_s;
+
+static const column_s schema[] = {
+    { .offset = offsetof(record_s, key), .size = sizeof(DATA_TYPE), },
+    { .offset = offsetof(record_s, tag), .size = sizeof(char), },
+    { .offset = offsetof(record_s, value), .size = sizeof(double), },
+};
+
+#define COLUMN_COUNT (sizeof(schema) / sizeof(column_s))
+
+static record_s make(const int i) {
+    return (record_s) { .key = i, .tag = (char)('a' + (i % 26)), .value = i * 0.5, };
+}
+
+TEST CREATE_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+
+    ASSERT_NEQm("[IRS-ERROR] Test queue columns is NULL.", NULL, test.columns);
+    ASSERT_EQm("[IRS-ERROR] Test queue column count is not COLUMN_COUNT.", COLUMN_COUNT, test.count);
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", scqu_is_empty(test));
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scqu_enqueue(&test, &record);
+    }
+    scqu_destroy(&test, destroy);
+
+    ASSERT_EQm("[IRS-ERROR] Test queue columns is not NULL.", NULL, test.columns);
+    ASSERT_EQm("[IRS-ERROR] Test queue column count is not zero.", (size_t)0, test.count);
+
+    PASS();
+}
+
+TEST ENQUEUE_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scqu_enqueue(&test, &record);
+    }
+
+    for (size_t c = 0; c < COLUMN_COUNT; ++c) {
+        ASSERT_EQm("[IRS-ERROR] Expected each column to hold every record's field.", (size_t)RECORD_COUNT, test.columns[c].size);
+    }
+    DATA_TYPE const * keys = test.columns[0].elements;
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected key column to be contiguous.", i, keys[i]);
+    }
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+TEST DEQUEUE_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scqu_enqueue(&test, &record);
+    }
+
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s expected = make(i);
+        record_s peeked = { 0 }, dequeued = { 0 };
+
+        scqu_peek(test, &peeked);
+        scqu_dequeue(&test, &dequeued);
+        ASSERT_EQm("[IRS-ERROR] Expected peeked key to be dequeued.", peeked.key, dequeued.key);
+        ASSERT_EQm("[IRS-ERROR] Expected gathered key.", expected.key, dequeued.key);
+        ASSERT_EQm("[IRS-ERROR] Expected gathered tag.", expected.tag, dequeued.tag);
+        ASSERTm("[IRS-ERROR] Expected gathered value.", expected.value == dequeued.value);
+    }
+    ASSERTm("[IRS-ERROR] Expected queue to be empty.", scqu_is_empty(test));
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+TEST DEQUEUE_02(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+
+    // interleave so that columns get compacted while records are still in queue
+    int enqueued = 0, dequeued = 0;
+    for (int round = 0; round < RECORD_COUNT; ++round) {
+        for (int i = 0; i < 3; ++i, ++enqueued) {
+            const record_s record = make(enqueued);
+            scqu_enqueue(&test, &record);
+        }
+        for (int i = 0; i < 2; ++i, ++dequeued) {
+            record_s record = { 0 };
+            scqu_dequeue(&test, &record);
+            ASSERT_EQm("[IRS-ERROR] Expected records in enqueue order.", dequeued, record.key);
+            ASSERT_EQm("[IRS-ERROR] Expected gathered tag.", make(dequeued).tag, record.tag);
+        }
+    }
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+TEST FOREACH_COLUMN_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scqu_enqueue(&test, &record);
+    }
+
+    int add = 10;
+    scqu_foreach_column(&test, 0, increment, &add);
+
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        record_s dequeued = { 0 };
+        scqu_dequeue(&test, &dequeued);
+        ASSERT_EQm("[IRS-ERROR] Expected key column to be incremented.", i + add, dequeued.key);
+        ASSERTm("[IRS-ERROR] Expected value column to be unchanged.", make(i).value == dequeued.value);
+    }
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+TEST MAP_COLUMN_01(void) {
+    scqueue_s test = scqu_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scqu_enqueue(&test, &record);
+    }
+
+    scqu_map_column(&test, 0, manage, &(function_ptr) { .compare = compare_reverse, });
+
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        record_s dequeued = { 0 };
+        scqu_dequeue(&test, &dequeued);
+        ASSERT_EQm("[IRS-ERROR] Expected only key column to be reversed.", RECORD_COUNT - 1 - i, dequeued.key);
+        ASSERT_EQm("[IRS-ERROR] Expected tag column to be unchanged.", make(i).tag, dequeued.tag);
+    }
+
+    scqu_destroy(&test, destroy);
+    PASS();
+}
+
+SUITE (scale_column_queue_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // enqueue
+    RUN_TEST(ENQUEUE_01);
+    // dequeue
+    RUN_TEST(DEQUEUE_01); RUN_TEST(DEQUEUE_02);
+    // foreach column
+    RUN_TEST(FOREACH_COLUMN_01);
+    // map column
+    RUN_TEST(MAP_COLUMN_01);
+}
\ No newline at end of file
@@ -750,6 +750,306 @@ TEST MAP_08(void) {
     PASS();
 }
 
+TEST AT_01(void) {
+    squeue_s test = sque_create();
+    const DATA_TYPE a = 42;
+    sque_enqueue(&test, &a, sizeof(DATA_TYPE));
+
+    DATA_TYPE * b = sque_at(&test, 0, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected element at index 0 to be 42.", 42, (*b));
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_02(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE * b = sque_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_03(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE * b = sque_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_04(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE * b = sque_at(&test, (size_t)i, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index i to be i.", i, (*b));
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST AT_05(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+    }
+
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE * b = sque_at(&test, (size_t)(i - (REALLOC_CHUNK >> 1)), sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected element at index to be i.", i, (*b));
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_01(void) {
+    squeue_s test = sque_create();
+    const DATA_TYPE a = 0;
+    sque_enqueue(&test, &a, sizeof(DATA_TYPE));
+
+    const DATA_TYPE c = 42;
+    sque_set(&test, 0, &c, sizeof(DATA_TYPE));
+
+    DATA_TYPE b = 0;
+    sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected to dequeue 42.", 42, b);
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_02(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        const DATA_TYPE a = 0;
+        sque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sque_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_03(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        const DATA_TYPE a = 0;
+        sque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sque_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST SET_04(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        const DATA_TYPE a = 0;
+        sque_enqueue(&test, &a, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_set(&test, (size_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_01(void) {
+    squeue_s test = sque_create();
+
+    squeue_cursor_s cursor = sque_begin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected cursor of empty queue to end.", sque_end(cursor));
+
+    cursor = sque_rbegin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected reverse cursor of empty queue to end.", sque_end(cursor));
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_02(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = 0;
+    for (squeue_cursor_s cursor = sque_begin(&test, sizeof(DATA_TYPE)); !sque_end(cursor); sque_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i++;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate over each element.", REALLOC_CHUNK + 1, i);
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_04(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+    }
+
+    int i = REALLOC_CHUNK >> 1;
+    for (squeue_cursor_s cursor = sque_begin(&test, sizeof(DATA_TYPE)); !sque_end(cursor); sque_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i++;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate over each element.", REALLOC_CHUNK + 1, i);
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_03(void) {
+    squeue_s test = sque_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = REALLOC_CHUNK;
+    for (squeue_cursor_s cursor = sque_rbegin(&test, sizeof(DATA_TYPE)); !sque_end(cursor); sque_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected reverse cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i--;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected reverse cursor to iterate over each element.", -1, i);
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_01(void) {
+    squeue_s test = sque_create();
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sque_map_parallel(&test, manage, merge, 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed queue to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_02(void) {
+    squeue_s test = sque_create();
+    for (int i = REALLOC_CHUNK; i >= 0; --i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sque_map_parallel(&test, manage, merge, 3, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed queue to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_03(void) {
+    squeue_s test = sque_create();
+    for (int i = REALLOC_CHUNK - 2; i >= 0; --i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sque_map_parallel(&test, manage, merge, REALLOC_CHUNK << 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed queue to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_04(void) {
+    squeue_s test = sque_create();
+    for (int i = (REALLOC_CHUNK >> 1) - 1; i >= 0; --i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+    for (int i = REALLOC_CHUNK - 1; i >= REALLOC_CHUNK >> 1; --i) {
+        sque_enqueue(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    // without merge each half is only sorted on its own
+    sque_map_parallel(&test, manage, NULL, 2, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare, }));
+
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sque_dequeue(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed queue to dequeue i.", i, b);
+    }
+
+    sque_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
 SUITE (scale_queue_unit_test) {
     // create
     RUN_TEST(CREATE_01);
@@ -772,4 +1072,12 @@ SUITE (scale_queue_unit_test) {
     // map
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03); RUN_TEST(MAP_04); RUN_TEST(MAP_05);
     RUN_TEST(MAP_06); RUN_TEST(MAP_07); RUN_TEST(MAP_08);
+    // at
+    RUN_TEST(AT_01); RUN_TEST(AT_02); RUN_TEST(AT_03); RUN_TEST(AT_04); RUN_TEST(AT_05);
+    // set
+    RUN_TEST(SET_01); RUN_TEST(SET_02); RUN_TEST(SET_03); RUN_TEST(SET_04);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(CURSOR_02); RUN_TEST(CURSOR_03); RUN_TEST(CURSOR_04);
+    // map parallel
+    RUN_TEST(MAP_PARALLEL_01); RUN_TEST(MAP_PARALLEL_02); RUN_TEST(MAP_PARALLEL_03); RUN_TEST(MAP_PARALLEL_04);
 }
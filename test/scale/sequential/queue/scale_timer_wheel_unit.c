@@ -0,0 +1,235 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/queue/swheel.h>
+
+#define TIMER_COUNT 1000
+#define HORIZON ((uint64_t)1 << 24)
+
+TEST CREATE_01(void) {
+    swheel_s test = swhl_create();
+
+    ASSERT_NEQm("[IRS-ERROR] Test wheel buckets is NULL.", NULL, test.buckets);
+    ASSERT_EQm("[IRS-ERROR] Test wheel tick is not zero.", (uint64_t)0, test.now);
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    swheel_s test = swhl_create();
+    for (int i = 0; i < TIMER_COUNT; ++i) {
+        swhl_insert(&test, (uint64_t)i * 97, &i, sizeof(DATA_TYPE));
+    }
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test wheel buckets is not NULL.", NULL, test.buckets);
+    ASSERT_EQm("[IRS-ERROR] Test wheel timers is not NULL.", NULL, test.timers.elements);
+    ASSERT_EQm("[IRS-ERROR] Test wheel size is not zero.", (size_t)0, test.size);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    swheel_s test = swhl_create();
+
+    const DATA_TYPE element = 42;
+    const uint64_t handle = swhl_insert(&test, 0, &element, sizeof(DATA_TYPE));
+    ASSERT_NEQm("[IRS-ERROR] Expected handle to not be zero.", (uint64_t)0, handle);
+    ASSERTm("[IRS-ERROR] Expected timer to be pending.", swhl_is_pending(test, handle));
+
+    DATA_TYPE expired = 0;
+    ASSERT_EQm("[IRS-ERROR] Expected zero delay timer to expire without advancing.", (size_t)1, swhl_expire(&test, &expired, 1, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected inserted element.", element, expired);
+    ASSERT_FALSEm("[IRS-ERROR] Expected taken timer to not be pending.", swhl_is_pending(test, handle));
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    swheel_s test = swhl_create();
+    for (int i = TIMER_COUNT; i > 0; --i) {
+        swhl_insert(&test, (uint64_t)i, &i, sizeof(DATA_TYPE));
+    }
+
+    for (int i = 1; i <= TIMER_COUNT; ++i) {
+        DATA_TYPE expired[2] = { 0 };
+        swhl_advance(&test, 1);
+        ASSERT_EQm("[IRS-ERROR] Expected exactly one timer to expire each tick.", (size_t)1, swhl_expire(&test, expired, 2, sizeof(DATA_TYPE)));
+        ASSERT_EQm("[IRS-ERROR] Expected timer to expire at its deadline.", i, expired[0]);
+    }
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    swheel_s test = swhl_create();
+
+    // deadlines spread over several levels, inserted at different ticks, none due before second half is inserted
+    const uint64_t gap = 12345;
+    uint64_t latest = 0;
+    for (uint64_t i = 0; i < TIMER_COUNT; ++i) {
+        if (i == TIMER_COUNT / 2) {
+            swhl_advance(&test, gap);
+        }
+        const uint64_t deadline = test.now + gap + ((i * 7919) % (1 << 20)) + 1;
+        swhl_insert(&test, deadline - test.now, &deadline, sizeof(uint64_t));
+        latest = deadline > latest ? deadline : latest;
+    }
+
+    size_t total = 0;
+    while (test.now < latest) {
+        swhl_advance(&test, 1);
+
+        uint64_t expired[8] = { 0 };
+        for (size_t count = 0; (count = swhl_expire(&test, expired, 8, sizeof(uint64_t))); total += count) {
+            for (size_t j = 0; j < count; ++j) {
+                ASSERT_EQm("[IRS-ERROR] Expected timer to expire at its deadline.", test.now, expired[j]);
+            }
+        }
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected every timer to expire.", (size_t)TIMER_COUNT, total);
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    swhl_destroy(&test, destroy, sizeof(uint64_t));
+    PASS();
+}
+
+TEST INSERT_04(void) {
+    swheel_s test = swhl_create();
+
+    const DATA_TYPE element = 7;
+    const uint64_t delay = (HORIZON * 2) + 3;
+    swhl_insert(&test, delay, &element, sizeof(DATA_TYPE));
+
+    DATA_TYPE expired = 0;
+    swhl_advance(&test, delay - 1);
+    ASSERT_EQm("[IRS-ERROR] Expected timer past horizon to not expire early.", (size_t)0, swhl_expire(&test, &expired, 1, sizeof(DATA_TYPE)));
+
+    swhl_advance(&test, 1);
+    ASSERT_EQm("[IRS-ERROR] Expected timer past horizon to expire at its deadline.", (size_t)1, swhl_expire(&test, &expired, 1, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected inserted element.", element, expired);
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CANCEL_01(void) {
+    swheel_s test = swhl_create();
+
+    const DATA_TYPE element = 42;
+    const uint64_t handle = swhl_insert(&test, 100, &element, sizeof(DATA_TYPE));
+
+    DATA_TYPE cancelled = 0;
+    ASSERTm("[IRS-ERROR] Expected pending timer to be cancelled.", swhl_cancel(&test, handle, &cancelled, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected cancelled element.", element, cancelled);
+    ASSERT_FALSEm("[IRS-ERROR] Expected cancelled timer to not be pending.", swhl_is_pending(test, handle));
+    ASSERT_FALSEm("[IRS-ERROR] Expected cancelled timer to not be cancelled again.", swhl_cancel(&test, handle, &cancelled, sizeof(DATA_TYPE)));
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    DATA_TYPE expired = 0;
+    swhl_advance(&test, 200);
+    ASSERT_EQm("[IRS-ERROR] Expected cancelled timer to not expire.", (size_t)0, swhl_expire(&test, &expired, 1, sizeof(DATA_TYPE)));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CANCEL_02(void) {
+    swheel_s test = swhl_create();
+
+    DATA_TYPE element = 0;
+    uint64_t previous = swhl_insert(&test, 50, &element, sizeof(DATA_TYPE));
+    for (int i = 1; i < TIMER_COUNT; ++i) {
+        swhl_cancel(&test, previous, &element, sizeof(DATA_TYPE));
+        const uint64_t handle = swhl_insert(&test, 50, &i, sizeof(DATA_TYPE));
+
+        ASSERT_NEQm("[IRS-ERROR] Expected reused slot to get new handle.", previous, handle);
+        ASSERT_FALSEm("[IRS-ERROR] Expected old handle of reused slot to not be pending.", swhl_is_pending(test, previous));
+        ASSERT_FALSEm("[IRS-ERROR] Expected old handle of reused slot to not be cancelled.", swhl_cancel(&test, previous, &element, sizeof(DATA_TYPE)));
+        previous = handle;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cancelled slots to be recycled.", (size_t)1, test.timers.size);
+
+    DATA_TYPE expired[2] = { 0 };
+    swhl_advance(&test, 50);
+    ASSERT_EQm("[IRS-ERROR] Expected only last timer to expire.", (size_t)1, swhl_expire(&test, expired, 2, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected last inserted element.", TIMER_COUNT - 1, expired[0]);
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CANCEL_03(void) {
+    swheel_s test = swhl_create();
+
+    const DATA_TYPE element = 42;
+    const uint64_t handle = swhl_insert(&test, 10, &element, sizeof(DATA_TYPE));
+    swhl_advance(&test, 10);
+
+    DATA_TYPE cancelled = 0;
+    ASSERTm("[IRS-ERROR] Expected expired but not taken timer to be cancelled.", swhl_cancel(&test, handle, &cancelled, sizeof(DATA_TYPE)));
+    ASSERT_EQm("[IRS-ERROR] Expected cancelled element.", element, cancelled);
+    ASSERT_EQm("[IRS-ERROR] Expected cancelled timer to not be taken.", (size_t)0, swhl_expire(&test, &cancelled, 1, sizeof(DATA_TYPE)));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST EXPIRE_01(void) {
+    swheel_s test = swhl_create();
+    for (int i = 0; i < TIMER_COUNT; ++i) {
+        swhl_insert(&test, 5000, &i, sizeof(DATA_TYPE));
+    }
+    swhl_advance(&test, 5000);
+
+    int expected = 0;
+    DATA_TYPE batch[7] = { 0 };
+    for (size_t count = 0; (count = swhl_expire(&test, batch, 7, sizeof(DATA_TYPE)));) {
+        expected += (int)count;
+        ASSERTm("[IRS-ERROR] Expected at most 7 elements per batch.", count <= 7);
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected every timer to be taken in batches.", TIMER_COUNT, expected);
+    ASSERTm("[IRS-ERROR] Expected wheel to be empty.", swhl_is_empty(test));
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST EXPIRE_02(void) {
+    swheel_s test = swhl_create();
+    for (int i = 0; i < TIMER_COUNT; ++i) {
+        swhl_insert(&test, (uint64_t)(i % 3) + 1, &i, sizeof(DATA_TYPE));
+    }
+
+    // timers expiring on later ticks queue behind ones not yet taken
+    swhl_advance(&test, 3);
+
+    DATA_TYPE expired[TIMER_COUNT] = { 0 };
+    ASSERT_EQm("[IRS-ERROR] Expected every timer to expire.", (size_t)TIMER_COUNT, swhl_expire(&test, expired, TIMER_COUNT, sizeof(DATA_TYPE)));
+    for (int i = 1; i < TIMER_COUNT; ++i) {
+        ASSERTm("[IRS-ERROR] Expected elements in order of expiry.", (expired[i - 1] % 3) <= (expired[i] % 3));
+    }
+
+    swhl_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_timer_wheel_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03); RUN_TEST(INSERT_04);
+    // cancel
+    RUN_TEST(CANCEL_01); RUN_TEST(CANCEL_02); RUN_TEST(CANCEL_03);
+    // expire
+    RUN_TEST(EXPIRE_01); RUN_TEST(EXPIRE_02);
+}
\ No newline at end of file
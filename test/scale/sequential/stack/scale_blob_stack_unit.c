@@ -0,0 +1,190 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/stack/sbstack.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define BLOB_COUNT (REALLOC_CHUNK * 3 + 5)
+#define MAX_LENGTH 17
+
+static size_t destroyed = 0;
+
+static void count(void * blob) {
+    (void)(blob);
+    destroyed++;
+}
+
+/// @brief Fills buffer with i-th blob, where every MAX_LENGTH-th blob is empty.
+static size_t make(const size_t i, char * buffer) {
+    const size_t length = i % MAX_LENGTH;
+    for (size_t j = 0; j < length; ++j) {
+        buffer[j] = (char)('a' + ((i + j) % 26));
+    }
+    return length;
+}
+
+/// @brief Checks that blobs are iterated in push order, counting them in arguments.
+static bool check(void * blob, const size_t length, void * args) {
+    size_t * index = args;
+    char expected[MAX_LENGTH] = { 0 };
+    if (length != make(*index, expected) || memcmp(blob, expected, length)) {
+        return false;
+    }
+    (*index)++;
+    return true;
+}
+
+static bool stop_at_ten(void * blob, const size_t length, void * args) {
+    (void)(blob); (void)(length);
+    size_t * index = args;
+    return ++(*index) < 10;
+}
+
+TEST CREATE_01(void) {
+    sbstack_s test = sbst_create();
+
+    ASSERT_EQm("[IRS-ERROR] Test stack bytes is not NULL.", NULL, test.bytes);
+    ASSERT_EQm("[IRS-ERROR] Test stack size is not zero.", (size_t)0, test.size);
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sbst_is_empty(test));
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbst_push(&test, buffer, length);
+    }
+
+    destroyed = 0;
+    sbst_destroy(&test, count);
+
+    ASSERT_EQm("[IRS-ERROR] Expected every blob to be destroyed.", (size_t)BLOB_COUNT, destroyed);
+    ASSERT_EQm("[IRS-ERROR] Test stack bytes is not NULL.", NULL, test.bytes);
+    ASSERT_EQm("[IRS-ERROR] Test stack length is not zero.", (size_t)0, test.length);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbst_push(&test, buffer, length);
+
+        size_t peeped = 0;
+        char const * blob = sbst_peep(test, &peeped);
+        ASSERT_EQm("[IRS-ERROR] Expected peeped length to be pushed length.", length, peeped);
+        ASSERTm("[IRS-ERROR] Expected peeped blob to be pushed blob.", !memcmp(buffer, blob, length));
+        ASSERT_EQm("[IRS-ERROR] Expected peeped blob to be aligned.", (size_t)0, (size_t)((uintptr_t)blob % sizeof(size_t)));
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected stack size to be BLOB_COUNT.", (size_t)BLOB_COUNT, test.size);
+    ASSERTm("[IRS-ERROR] Expected blobs to share a single buffer.", test.length <= test.capacity);
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+TEST POP_01(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbst_push(&test, buffer, length);
+    }
+
+    for (size_t i = BLOB_COUNT; i > 0; --i) {
+        const size_t length = make(i - 1, buffer);
+
+        size_t popped = 0;
+        char const * blob = sbst_pop(&test, &popped);
+        ASSERT_EQm("[IRS-ERROR] Expected popped length to be pushed length.", length, popped);
+        ASSERTm("[IRS-ERROR] Expected popped blob to be pushed blob.", !memcmp(buffer, blob, length));
+    }
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sbst_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Expected stack length to be zero.", (size_t)0, test.length);
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+TEST POP_02(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+
+    // interleave so that popped records get overwritten by later pushes
+    size_t pushed = 0;
+    for (size_t round = 0; round < BLOB_COUNT; ++round) {
+        for (size_t i = 0; i < 3; ++i, ++pushed) {
+            const size_t length = make(pushed, buffer);
+            sbst_push(&test, buffer, length);
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            const size_t length = make(--pushed, buffer);
+            size_t popped = 0;
+            char const * blob = sbst_pop(&test, &popped);
+            ASSERT_EQm("[IRS-ERROR] Expected popped length to be last pushed length.", length, popped);
+            ASSERTm("[IRS-ERROR] Expected popped blob to be last pushed blob.", !memcmp(buffer, blob, length));
+        }
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected one blob left per round.", (size_t)BLOB_COUNT, test.size);
+
+    size_t index = 0;
+    sbst_foreach(&test, check, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected remaining blobs to be unchanged.", (size_t)BLOB_COUNT, index);
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+TEST FOREACH_01(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbst_push(&test, buffer, length);
+    }
+
+    size_t index = 0;
+    sbst_foreach(&test, check, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected to iterate each blob from bottom to top.", (size_t)BLOB_COUNT, index);
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+TEST FOREACH_02(void) {
+    sbstack_s test = sbst_create();
+    char buffer[MAX_LENGTH] = { 0 };
+    for (size_t i = 0; i < BLOB_COUNT; ++i) {
+        const size_t length = make(i, buffer);
+        sbst_push(&test, buffer, length);
+    }
+
+    size_t index = 0;
+    sbst_foreach(&test, stop_at_ten, &index);
+    ASSERT_EQm("[IRS-ERROR] Expected iteration to stop when operate returns false.", (size_t)10, index);
+
+    sbst_destroy(&test, count);
+    PASS();
+}
+
+SUITE (scale_blob_stack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02);
+    // foreach
+    RUN_TEST(FOREACH_01); RUN_TEST(FOREACH_02);
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/stack/scstack.h>
+
+#include <stddef.h>
+
+#define RECORD_COUNT (REALLOC_CHUNK * 3 + 5)
+
+typedef struct record {
+    DATA_TYPE key;
+    char tag;
+    double value;
+} record_s;
+
+static const column_s schema[] = {
+    { .offset = offsetof(record_s, key), .size = sizeof(DATA_TYPE), },
+    { .offset = offsetof(record_s, tag), .size = sizeof(char), },
+    { .offset = offsetof(record_s, value), .size = sizeof(double), },
+};
+
+#define COLUMN_COUNT (sizeof(schema) / sizeof(column_s))
+
+static record_s make(const int i) {
+    return (record_s) { .key = i, .tag = (char)('a' + (i % 26)), .value = i * 0.5, };
+}
+
+TEST CREATE_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+
+    ASSERT_NEQm("[IRS-ERROR] Test stack columns is NULL.", NULL, test.columns);
+    ASSERT_EQm("[IRS-ERROR] Test stack column count is not COLUMN_COUNT.", COLUMN_COUNT, test.count);
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", scst_is_empty(test));
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scst_push(&test, &record);
+    }
+    scst_destroy(&test, destroy);
+
+    ASSERT_EQm("[IRS-ERROR] Test stack columns is not NULL.", NULL, test.columns);
+    ASSERT_EQm("[IRS-ERROR] Test stack column count is not zero.", (size_t)0, test.count);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scst_push(&test, &record);
+    }
+
+    for (size_t c = 0; c < COLUMN_COUNT; ++c) {
+        ASSERT_EQm("[IRS-ERROR] Expected each column to hold every record's field.", (size_t)RECORD_COUNT, test.columns[c].size);
+    }
+    DATA_TYPE const * keys = test.columns[0].elements;
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        ASSERT_EQm("[IRS-ERROR] Expected key column to be contiguous.", i, keys[i]);
+    }
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+TEST POP_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scst_push(&test, &record);
+    }
+
+    for (int i = RECORD_COUNT - 1; i >= 0; --i) {
+        const record_s expected = make(i);
+        record_s peeped = { 0 }, popped = { 0 };
+
+        scst_peep(test, &peeped);
+        scst_pop(&test, &popped);
+        ASSERT_EQm("[IRS-ERROR] Expected peeped key to be popped.", peeped.key, popped.key);
+        ASSERT_EQm("[IRS-ERROR] Expected gathered key.", expected.key, popped.key);
+        ASSERT_EQm("[IRS-ERROR] Expected gathered tag.", expected.tag, popped.tag);
+        ASSERTm("[IRS-ERROR] Expected gathered value.", expected.value == popped.value);
+    }
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", scst_is_empty(test));
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+TEST POP_02(void) {
+    scstack_s test = scst_create(schema + 1, COLUMN_COUNT - 1); // schema without key column
+
+    const record_s record = make(42);
+    scst_push(&test, &record);
+
+    record_s popped = { .key = -1, };
+    scst_pop(&test, &popped);
+    ASSERT_EQm("[IRS-ERROR] Expected field outside of schema to be left as it is.", -1, popped.key);
+    ASSERT_EQm("[IRS-ERROR] Expected gathered tag.", record.tag, popped.tag);
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+TEST FOREACH_COLUMN_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scst_push(&test, &record);
+    }
+
+    int add = 10;
+    scst_foreach_column(&test, 0, increment, &add);
+
+    for (int i = RECORD_COUNT - 1; i >= 0; --i) {
+        record_s popped = { 0 };
+        scst_pop(&test, &popped);
+        ASSERT_EQm("[IRS-ERROR] Expected key column to be incremented.", i + add, popped.key);
+        ASSERTm("[IRS-ERROR] Expected value column to be unchanged.", make(i).value == popped.value);
+    }
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+TEST MAP_COLUMN_01(void) {
+    scstack_s test = scst_create(schema, COLUMN_COUNT);
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        const record_s record = make(i);
+        scst_push(&test, &record);
+    }
+
+    scst_map_column(&test, 0, manage, &(function_ptr) { .compare = compare_reverse, });
+
+    for (int i = 0; i < RECORD_COUNT; ++i) {
+        record_s popped = { 0 };
+        scst_pop(&test, &popped);
+        ASSERT_EQm("[IRS-ERROR] Expected only key column to be reversed.", i, popped.key);
+        ASSERT_EQm("[IRS-ERROR] Expected tag column to be unchanged.", make(RECORD_COUNT - 1 - i).tag, popped.tag);
+    }
+
+    scst_destroy(&test, destroy);
+    PASS();
+}
+
+SUITE (scale_column_stack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02);
+    // foreach column
+    RUN_TEST(FOREACH_COLUMN_01);
+    // map column
+    RUN_TEST(MAP_COLUMN_01);
+}
\ No newline at end of file
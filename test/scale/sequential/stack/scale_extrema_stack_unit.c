@@ -0,0 +1,212 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/stack/sestack.h>
+
+#include <stdlib.h>
+
+#define ELEMENT_COUNT 1000
+
+/// @brief Scans first 'n' elements for their minimum and maximum.
+static void extrema(DATA_TYPE const * elements, const size_t n, DATA_TYPE * minimum, DATA_TYPE * maximum) {
+    (*minimum) = (*maximum) = elements[0];
+    for (size_t i = 1; i < n; ++i) {
+        (*minimum) = elements[i] < (*minimum) ? elements[i] : (*minimum);
+        (*maximum) = elements[i] > (*maximum) ? elements[i] : (*maximum);
+    }
+}
+
+TEST CREATE_01(void) {
+    sestack_s test = sest_create(compare);
+
+    ASSERT_EQm("[IRS-ERROR] Test stack elements is not NULL.", NULL, test.stack.elements);
+    ASSERT_EQm("[IRS-ERROR] Test stack minima is not NULL.", NULL, test.minima.elements);
+    ASSERT_EQm("[IRS-ERROR] Test stack maxima is not NULL.", NULL, test.maxima.elements);
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sest_is_empty(test));
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    sestack_s test = sest_create(compare);
+    for (int i = 0; i < REALLOC_CHUNK * 3; ++i) {
+        const DATA_TYPE element = (i % 2) ? i : -i;
+        sest_push(&test, &element, sizeof(DATA_TYPE));
+    }
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+
+    ASSERT_EQm("[IRS-ERROR] Test stack elements is not NULL.", NULL, test.stack.elements);
+    ASSERT_EQm("[IRS-ERROR] Test stack minima is not NULL.", NULL, test.minima.elements);
+    ASSERT_EQm("[IRS-ERROR] Test stack maxima is not NULL.", NULL, test.maxima.elements);
+    ASSERT_EQm("[IRS-ERROR] Test stack size is not zero.", (size_t)0, test.stack.size);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    sestack_s test = sest_create(compare);
+
+    DATA_TYPE elements[ELEMENT_COUNT] = { 0 }, minimum = 0, maximum = 0, expected_minimum = 0, expected_maximum = 0;
+    srand(42);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        elements[i] = rand() % 100;
+        sest_push(&test, &elements[i], sizeof(DATA_TYPE));
+
+        extrema(elements, i + 1, &expected_minimum, &expected_maximum);
+        sest_minimum(test, &minimum, sizeof(DATA_TYPE));
+        sest_maximum(test, &maximum, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected minimum of pushed elements.", expected_minimum, minimum);
+        ASSERT_EQm("[IRS-ERROR] Expected maximum of pushed elements.", expected_maximum, maximum);
+    }
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    sestack_s test = sest_create(compare);
+    for (int i = 0; i < ELEMENT_COUNT; ++i) {
+        sest_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected single minimum record for increasing elements.", (size_t)1, test.minima.size);
+    ASSERT_EQm("[IRS-ERROR] Expected record for each increasing element.", (size_t)ELEMENT_COUNT, test.maxima.size);
+
+    const DATA_TYPE equal = ELEMENT_COUNT - 1;
+    for (int i = 0; i < ELEMENT_COUNT; ++i) {
+        sest_push(&test, &equal, sizeof(DATA_TYPE));
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected equal maxima to not be recorded.", (size_t)ELEMENT_COUNT, test.maxima.size);
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST PUSH_N_01(void) {
+    sestack_s test = sest_create(compare);
+
+    DATA_TYPE elements[ELEMENT_COUNT] = { 0 }, minimum = 0, maximum = 0, expected_minimum = 0, expected_maximum = 0;
+    srand(42);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        elements[i] = rand() % 1000;
+    }
+
+    for (size_t pushed = 0, n = 1; pushed < ELEMENT_COUNT; pushed += n, n++) {
+        n = n < ELEMENT_COUNT - pushed ? n : ELEMENT_COUNT - pushed;
+        sest_push_n(&test, &elements[pushed], n, sizeof(DATA_TYPE));
+
+        extrema(elements, pushed + n, &expected_minimum, &expected_maximum);
+        sest_minimum(test, &minimum, sizeof(DATA_TYPE));
+        sest_maximum(test, &maximum, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected minimum of pushed batches.", expected_minimum, minimum);
+        ASSERT_EQm("[IRS-ERROR] Expected maximum of pushed batches.", expected_maximum, maximum);
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected every element pushed.", (size_t)ELEMENT_COUNT, test.stack.size);
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_01(void) {
+    sestack_s test = sest_create(compare);
+
+    DATA_TYPE elements[ELEMENT_COUNT] = { 0 }, minimum = 0, maximum = 0, expected_minimum = 0, expected_maximum = 0;
+    srand(42);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        elements[i] = rand() % 100;
+    }
+    sest_push_n(&test, elements, ELEMENT_COUNT, sizeof(DATA_TYPE));
+
+    for (size_t i = ELEMENT_COUNT; i > 1; --i) {
+        DATA_TYPE popped = -1;
+        sest_pop(&test, &popped, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected top element to be popped.", elements[i - 1], popped);
+
+        extrema(elements, i - 1, &expected_minimum, &expected_maximum);
+        sest_minimum(test, &minimum, sizeof(DATA_TYPE));
+        sest_maximum(test, &maximum, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected minimum of remaining elements.", expected_minimum, minimum);
+        ASSERT_EQm("[IRS-ERROR] Expected maximum of remaining elements.", expected_maximum, maximum);
+    }
+
+    DATA_TYPE popped = -1;
+    sest_pop(&test, &popped, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sest_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Expected minima to be empty.", (size_t)0, test.minima.size);
+    ASSERT_EQm("[IRS-ERROR] Expected maxima to be empty.", (size_t)0, test.maxima.size);
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_N_01(void) {
+    sestack_s test = sest_create(compare);
+
+    DATA_TYPE elements[ELEMENT_COUNT] = { 0 }, popped[ELEMENT_COUNT] = { 0 };
+    DATA_TYPE minimum = 0, maximum = 0, expected_minimum = 0, expected_maximum = 0;
+    srand(42);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        elements[i] = rand() % 1000;
+    }
+    sest_push_n(&test, elements, ELEMENT_COUNT, sizeof(DATA_TYPE));
+
+    for (size_t left = ELEMENT_COUNT, n = 1; left; left -= n, n++) {
+        n = n < left ? n : left;
+        sest_pop_n(&test, popped, n, sizeof(DATA_TYPE));
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQm("[IRS-ERROR] Expected elements popped from top to bottom.", elements[left - 1 - i], popped[i]);
+        }
+
+        if (left == n) {
+            break;
+        }
+        extrema(elements, left - n, &expected_minimum, &expected_maximum);
+        sest_minimum(test, &minimum, sizeof(DATA_TYPE));
+        sest_maximum(test, &maximum, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected minimum of remaining elements.", expected_minimum, minimum);
+        ASSERT_EQm("[IRS-ERROR] Expected maximum of remaining elements.", expected_maximum, maximum);
+    }
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", sest_is_empty(test));
+    ASSERT_EQm("[IRS-ERROR] Expected minima to be empty.", (size_t)0, test.minima.size);
+    ASSERT_EQm("[IRS-ERROR] Expected maxima to be empty.", (size_t)0, test.maxima.size);
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST POP_N_02(void) {
+    sestack_s test = sest_create(compare_reverse);
+
+    const DATA_TYPE elements[] = { 5, 3, 3, 8, 1, 8, 2, };
+    sest_push_n(&test, elements, sizeof(elements) / sizeof(DATA_TYPE), sizeof(DATA_TYPE));
+
+    DATA_TYPE popped[3] = { 0 }, minimum = 0, maximum = 0;
+    sest_pop_n(&test, popped, 3, sizeof(DATA_TYPE));
+    sest_minimum(test, &minimum, sizeof(DATA_TYPE));
+    sest_maximum(test, &maximum, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected reversed comparator's minimum to be largest element.", 8, minimum);
+    ASSERT_EQm("[IRS-ERROR] Expected reversed comparator's maximum to be smallest element.", 3, maximum);
+
+    sest_pop_n(&test, popped, 0, sizeof(DATA_TYPE));
+    ASSERT_EQm("[IRS-ERROR] Expected popping zero elements to keep size.", (size_t)4, test.stack.size);
+
+    sest_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+SUITE (scale_extrema_stack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // push n
+    RUN_TEST(PUSH_N_01);
+    // pop
+    RUN_TEST(POP_01);
+    // pop n
+    RUN_TEST(POP_N_01); RUN_TEST(POP_N_02);
+}
\ No newline at end of file
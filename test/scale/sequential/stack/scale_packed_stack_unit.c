@@ -0,0 +1,222 @@
+#include <unit.h>
+
+#include <helper/helper.h>
+
+#include <scale/sequential/stack/spstack.h>
+
+#define VALUE_COUNT (REALLOC_CHUNK * 64 * 3 + 5)
+
+static const size_t widths[] = { 1, 2, 3, 4, 7, 13, 32, 63, 64, };
+#define WIDTH_COUNT (sizeof(widths) / sizeof(size_t))
+
+/// @brief Creates i-th value that fits into width.
+static uint64_t make(const size_t i, const size_t width) {
+    return ((uint64_t)(i) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - width);
+}
+
+static void sum(void * words, const size_t n, const size_t size, void * args) {
+    (void)(size);
+    uint64_t const * convert = words;
+    size_t * bits = args;
+    for (size_t i = 0; i < n; ++i) {
+        (*bits) += (size_t)__builtin_popcountll(convert[i]);
+    }
+}
+
+TEST CREATE_01(void) {
+    spstack_s test = spst_create(1);
+
+    ASSERT_EQm("[IRS-ERROR] Test stack words is not NULL.", NULL, test.words);
+    ASSERT_EQm("[IRS-ERROR] Test stack width is not one.", (size_t)1, test.width);
+    ASSERTm("[IRS-ERROR] Expected stack to be empty.", spst_is_empty(test));
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    spstack_s test = spst_create(3);
+    for (size_t i = 0; i < VALUE_COUNT; ++i) {
+        spst_push(&test, make(i, 3));
+    }
+    spst_destroy(&test);
+
+    ASSERT_EQm("[IRS-ERROR] Test stack words is not NULL.", NULL, test.words);
+    ASSERT_EQm("[IRS-ERROR] Test stack size is not zero.", (size_t)0, test.size);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    spstack_s test = spst_create(1);
+    for (size_t i = 0; i < 64; ++i) {
+        spst_push(&test, i & 1);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected 64 bits to be packed into a single word.", UINT64_C(0xAAAAAAAAAAAAAAAA), test.words[0]);
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    spstack_s test = spst_create(3);
+    for (size_t i = 0; i < 22; ++i) {
+        spst_push(&test, 7);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected 21 values in first word and highest bit unused.", UINT64_C(0x7FFFFFFFFFFFFFFF), test.words[0]);
+    ASSERT_EQm("[IRS-ERROR] Expected 22nd value to start next word.", (uint64_t)7, test.words[1]);
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST POP_01(void) {
+    for (size_t w = 0; w < WIDTH_COUNT; ++w) {
+        spstack_s test = spst_create(widths[w]);
+        for (size_t i = 0; i < VALUE_COUNT; ++i) {
+            spst_push(&test, make(i, widths[w]));
+        }
+
+        for (size_t i = VALUE_COUNT; i > 0; --i) {
+            const uint64_t peeped = spst_peep(test);
+            ASSERT_EQm("[IRS-ERROR] Expected peeped value to be popped.", peeped, spst_pop(&test));
+            ASSERT_EQm("[IRS-ERROR] Expected values in reverse push order.", make(i - 1, widths[w]), peeped);
+        }
+        ASSERTm("[IRS-ERROR] Expected stack to be empty.", spst_is_empty(test));
+        ASSERT_EQm("[IRS-ERROR] Expected emptied stack to free its words.", NULL, test.words);
+
+        spst_destroy(&test);
+    }
+
+    PASS();
+}
+
+TEST POP_02(void) {
+    spstack_s test = spst_create(4);
+
+    // interleave so that popped bits get overwritten by later pushes, leaving one value per round
+    size_t pushed = 0;
+    for (size_t round = 0; round < VALUE_COUNT; ++round) {
+        for (size_t i = 0; i < 3; ++i, ++pushed) {
+            spst_push(&test, make(pushed, 4));
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            ASSERT_EQm("[IRS-ERROR] Expected last pushed value.", make(--pushed, 4), spst_pop(&test));
+        }
+    }
+
+    for (size_t i = VALUE_COUNT; i > 0; --i) {
+        ASSERT_EQm("[IRS-ERROR] Expected remaining values to be unchanged.", make(i - 1, 4), spst_pop(&test));
+    }
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST COUNT_01(void) {
+    spstack_s test = spst_create(1);
+    size_t ones = 0;
+    for (size_t i = 0; i < VALUE_COUNT; ++i) {
+        const uint64_t bit = make(i, 1);
+        ones += (size_t)bit;
+        spst_push(&test, bit);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected count of ones to be popcount.", ones, spst_count(&test, 1));
+    ASSERT_EQm("[IRS-ERROR] Expected count of zeros to be the rest.", (size_t)VALUE_COUNT - ones, spst_count(&test, 0));
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST COUNT_02(void) {
+    for (size_t w = 0; w < WIDTH_COUNT; ++w) {
+        spstack_s test = spst_create(widths[w]);
+        size_t expected = 0;
+        const uint64_t value = make(7, widths[w]);
+        for (size_t i = 0; i < VALUE_COUNT; ++i) {
+            const uint64_t pushed = make(i % 11, widths[w]);
+            if (pushed == value) {
+                expected++;
+            }
+            spst_push(&test, pushed);
+        }
+
+        ASSERT_EQm("[IRS-ERROR] Expected count of equal values.", expected, spst_count(&test, value));
+
+        spst_destroy(&test);
+    }
+
+    PASS();
+}
+
+TEST FIND_01(void) {
+    for (size_t w = 0; w < WIDTH_COUNT; ++w) {
+        spstack_s test = spst_create(widths[w]);
+        const uint64_t marker = ~UINT64_C(0) >> (64 - widths[w]);
+        spst_push(&test, marker);
+        for (size_t i = 0; i < VALUE_COUNT; ++i) {
+            spst_push(&test, 0);
+        }
+
+        ASSERT_EQm("[IRS-ERROR] Expected marker to be at the bottom.", (size_t)VALUE_COUNT, spst_find(&test, marker));
+        ASSERT_EQm("[IRS-ERROR] Expected zero to be at the top.", (size_t)0, spst_find(&test, 0));
+
+        spst_push(&test, marker);
+        spst_push(&test, 0);
+        ASSERT_EQm("[IRS-ERROR] Expected topmost marker to be found.", (size_t)1, spst_find(&test, marker));
+
+        spst_destroy(&test);
+    }
+
+    PASS();
+}
+
+TEST FIND_02(void) {
+    spstack_s test = spst_create(2);
+    for (size_t i = 0; i < VALUE_COUNT; ++i) {
+        spst_push(&test, i & 1);
+    }
+
+    ASSERT_EQm("[IRS-ERROR] Expected missing value to return size.", (size_t)VALUE_COUNT, spst_find(&test, 3));
+    ASSERT_EQm("[IRS-ERROR] Expected missing value to not be counted.", (size_t)0, spst_count(&test, 3));
+
+    spst_destroy(&test);
+    PASS();
+}
+
+TEST MAP_01(void) {
+    spstack_s test = spst_create(1);
+    for (size_t i = 0; i < VALUE_COUNT; ++i) {
+        spst_push(&test, 1);
+    }
+    for (size_t i = 0; i < VALUE_COUNT / 2; ++i) {
+        spst_pop(&test);
+    }
+
+    size_t bits = 0;
+    spst_map(&test, sum, &bits);
+    ASSERT_EQm("[IRS-ERROR] Expected popped bits to be cleared.", test.size, bits);
+
+    spst_destroy(&test);
+    PASS();
+}
+
+SUITE (scale_packed_stack_unit_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02);
+    // count
+    RUN_TEST(COUNT_01); RUN_TEST(COUNT_02);
+    // find
+    RUN_TEST(FIND_01); RUN_TEST(FIND_02);
+    // map
+    RUN_TEST(MAP_01);
+}
\ No newline at end of file
@@ -750,6 +750,131 @@ TEST MAP_08(void) {
     PASS();
 }
 
+TEST CURSOR_01(void) {
+    sstack_s test = sstk_create();
+
+    sstack_cursor_s cursor = sstk_begin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected cursor of empty stack to end.", sstk_end(cursor));
+
+    cursor = sstk_rbegin(&test, sizeof(DATA_TYPE));
+    ASSERTm("[IRS-ERROR] Expected reverse cursor of empty stack to end.", sstk_end(cursor));
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_02(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = 0;
+    for (sstack_cursor_s cursor = sstk_begin(&test, sizeof(DATA_TYPE)); !sstk_end(cursor); sstk_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i++;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected cursor to iterate over each element.", REALLOC_CHUNK + 1, i);
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST CURSOR_03(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    int i = REALLOC_CHUNK;
+    for (sstack_cursor_s cursor = sstk_rbegin(&test, sizeof(DATA_TYPE)); !sstk_end(cursor); sstk_next(&cursor)) {
+        ASSERT_EQm("[IRS-ERROR] Expected reverse cursor element to be i.", i, *(DATA_TYPE*)(cursor.element));
+        i--;
+    }
+    ASSERT_EQm("[IRS-ERROR] Expected reverse cursor to iterate over each element.", -1, i);
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_01(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sstk_map_parallel(&test, manage, merge, 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed stack to pop i.", i, b);
+    }
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_02(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sstk_map_parallel(&test, manage, merge, 3, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = 0; i < REALLOC_CHUNK + 1; ++i) {
+        DATA_TYPE b = 0;
+        sstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed stack to pop i.", i, b);
+    }
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_03(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    sstk_map_parallel(&test, manage, merge, REALLOC_CHUNK << 1, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = 0; i < REALLOC_CHUNK - 1; ++i) {
+        DATA_TYPE b = 0;
+        sstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed stack to pop i.", i, b);
+    }
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
+TEST MAP_PARALLEL_04(void) {
+    sstack_s test = sstk_create();
+    for (int i = 0; i < REALLOC_CHUNK; ++i) {
+        sstk_push(&test, &i, sizeof(DATA_TYPE));
+    }
+
+    // without merge each half is only sorted on its own
+    sstk_map_parallel(&test, manage, NULL, 2, sizeof(DATA_TYPE), &((function_ptr) { .compare = compare_reverse, }));
+
+    for (int i = REALLOC_CHUNK >> 1; i < REALLOC_CHUNK; ++i) {
+        DATA_TYPE b = 0;
+        sstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed stack to pop i.", i, b);
+    }
+    for (int i = 0; i < REALLOC_CHUNK >> 1; ++i) {
+        DATA_TYPE b = 0;
+        sstk_pop(&test, &b, sizeof(DATA_TYPE));
+        ASSERT_EQm("[IRS-ERROR] Expected managed stack to pop i.", i, b);
+    }
+
+    sstk_destroy(&test, destroy, sizeof(DATA_TYPE));
+    PASS();
+}
+
 SUITE (scale_stack_unit_test) {
     // create
     RUN_TEST(CREATE_01);
@@ -772,4 +897,8 @@ SUITE (scale_stack_unit_test) {
     // map
     RUN_TEST(MAP_01); RUN_TEST(MAP_02); RUN_TEST(MAP_03); RUN_TEST(MAP_04); RUN_TEST(MAP_05);
     RUN_TEST(MAP_06); RUN_TEST(MAP_07); RUN_TEST(MAP_08);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(CURSOR_02); RUN_TEST(CURSOR_03);
+    // map parallel
+    RUN_TEST(MAP_PARALLEL_01); RUN_TEST(MAP_PARALLEL_02); RUN_TEST(MAP_PARALLEL_03); RUN_TEST(MAP_PARALLEL_04);
 }
@@ -4,7 +4,19 @@
 #include <greatest.h>
 
 SUITE_EXTERN(scale_stack_unit_test);
+SUITE_EXTERN(scale_extrema_stack_unit_test);
+SUITE_EXTERN(scale_column_stack_unit_test);
+SUITE_EXTERN(scale_blob_stack_unit_test);
+SUITE_EXTERN(scale_packed_stack_unit_test);
 SUITE_EXTERN(scale_queue_unit_test);
-//SUITE_EXTERN(scale_deque_unit_test);
+SUITE_EXTERN(scale_aggregate_queue_unit_test);
+SUITE_EXTERN(scale_timer_wheel_unit_test);
+SUITE_EXTERN(scale_column_queue_unit_test);
+SUITE_EXTERN(scale_blob_queue_unit_test);
+SUITE_EXTERN(scale_deque_unit_test);
+SUITE_EXTERN(scale_monotonic_deque_unit_test);
+SUITE_EXTERN(scale_ring_unit_test);
+SUITE_EXTERN(scale_heap_unit_test);
+SUITE_EXTERN(scale_radix_heap_unit_test);
 
 #endif // UNIT_H